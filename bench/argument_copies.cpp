@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Counts the copies and moves of an argument emitted by value,
+ * and measures emitting large by-value arguments.
+ */
+
+#include "bench/bench.h"
+#include "src/hydrosig.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+struct counted
+{
+    static unsigned int copies;
+    static unsigned int moves;
+
+    counted() { ; }
+    counted(const counted& /*src*/) { copies++; }
+    counted(counted&& /*src*/) { moves++; }
+};
+
+unsigned int counted::copies = 0;
+unsigned int counted::moves = 0;
+
+/**< Keeps the slots from being optimised away */
+volatile std::size_t sink = 0;
+
+void receiveCounted(counted /*value*/)
+{
+    ;
+}
+
+void receiveString(std::string value)
+{
+    sink = value.size();
+}
+
+void receiveVector(std::vector<int> value)
+{
+    sink = value.size();
+}
+
+int main()
+{
+    for(unsigned int slots : {1u, 4u})
+    {
+        hydrosig::signal<void(counted)> signal;
+
+        for(unsigned int i = 0; i < slots; ++i) signal.connect(&receiveCounted);
+
+        counted::copies = 0;
+        counted::moves = 0;
+        signal.emit(counted());
+
+        std::printf("%u by-value slots, rvalue emitted: %u copies, %u moves\n",
+                    slots, counted::copies, counted::moves);
+    }
+
+    const std::string text(256, 'x');
+    const std::vector<int> numbers(64, 1);
+
+    for(unsigned int slots : {1u, 4u})
+    {
+        hydrosig::signal<void(std::string)> strings;
+        hydrosig::signal<void(std::vector<int>)> vectors;
+
+        for(unsigned int i = 0; i < slots; ++i)
+        {
+            strings.connect(&receiveString);
+            vectors.connect(&receiveVector);
+        }
+
+        std::printf("%u slots, 256 bytes: std::string %6.1f ns, std::vector<int> %6.1f ns\n",
+                    slots,
+                    nanosecondsPer(1000000, [&]{ strings.emit(std::string(text)); }),
+                    nanosecondsPer(1000000, [&]{ vectors.emit(std::vector<int>(numbers)); }));
+    }
+
+    // Read once, so the stores are not dead
+    static_cast<void>(sink);
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef HYDROSIG_BENCH_H_INCLUDED
+#define HYDROSIG_BENCH_H_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+
+
+/**
+ * @brief   Measures the average time of a piece of code.
+ * @param   iterations The number of times to run the code.
+ * @param   function The code to run.
+ * @return  The average time of one run, in nanoseconds.
+ */
+template<class Function>
+double nanosecondsPer(unsigned int iterations, Function function)
+{
+    // Warm up caches and branch predictors
+    for(unsigned int i = 0; i < iterations / 10; ++i) function();
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    for(unsigned int i = 0; i < iterations; ++i) function();
+
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / iterations;
+}
+
+
+#endif // HYDROSIG_BENCH_H_INCLUDED
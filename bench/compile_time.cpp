@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Translation unit measured by compile_time.sh. It includes the
+ * whole library and instantiates signals of a few arities, the way
+ * a typical user of the library would. It has no main function.
+ */
+
+#include "src/hydrosig.h"
+
+
+struct receiver
+{
+    int m_sum = 0;
+
+    void receive0() { ++m_sum; }
+    void receive1(int a) { m_sum += a; }
+    void receive2(int a, double b) { m_sum += a + int(b); }
+    void receive3(int a, double b, long c) { m_sum += a + int(b) + int(c); }
+};
+
+int instantiate()
+{
+    receiver r;
+    hydrosig::signal<void()> signal0;
+    hydrosig::signal<void(int)> signal1;
+    hydrosig::signal<void(int, double)> signal2;
+    hydrosig::signal<void(int, double, long)> signal3;
+
+    signal0.connect(&r, &receiver::receive0);
+    signal1.connect(&r, &receiver::receive1);
+    signal2.connect(&r, &receiver::receive2);
+    signal3.connect(&r, &receiver::receive3);
+    signal1.connect([&r](int a) { r.m_sum -= a; });
+
+    signal0.emit();
+    signal1.emit(1);
+    signal2.emit(1, 2.0);
+    signal3.emit(1, 2.0, 3);
+
+    return r.m_sum;
+}
@@ -0,0 +1,59 @@
+#!/bin/sh
+#
+# Measures the cost of including the library in a translation unit:
+# the preprocessed line count, the time of parsing it, the time of
+# compiling it with optimisation, and the size of the object code.
+#
+# Usage: bench/compile_time.sh [git-ref]
+#
+# Run from the root of the repository. With a git ref, the tree at
+# that ref is measured with the same translation unit as well, for
+# comparing before and after a change. CXX and CXXFLAGS are honoured,
+# RUNS sets the number of runs whose best time is reported.
+
+set -e
+
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:--std=c++17}
+RUNS=${RUNS:-3}
+UNIT=$(pwd)/bench/compile_time.cpp
+SCRATCH=$(mktemp -d)
+
+trap 'rm -rf "$SCRATCH"' EXIT
+
+# Prints the best wall-clock time of RUNS runs of a command, in seconds
+best_time()
+{
+    best=""
+    run=0
+    while [ $run -lt "$RUNS" ]; do
+        start=$(date +%s.%N)
+        "$@" > /dev/null
+        end=$(date +%s.%N)
+        best=$(echo "$start $end $best" | awk '{ t = $2 - $1; if($3 == "" || t < $3) print t; else print $3 }')
+        run=$((run + 1))
+    done
+    printf '%.2f' "$best"
+}
+
+# Measures the tree rooted at the given directory
+measure()
+{
+    cd "$2"
+    lines=$($CXX $CXXFLAGS -I. -E "$UNIT" | wc -l)
+    parse=$(best_time $CXX $CXXFLAGS -I. -fsyntax-only "$UNIT")
+    build=$(best_time $CXX $CXXFLAGS -O2 -I. -c "$UNIT" -o "$SCRATCH/unit.o")
+    text=$(size "$SCRATCH/unit.o" | awk 'NR == 2 { print $1 }')
+    printf '%-12.12s %10s %10s %10s %10s\n' "$1" "$lines" "$parse" "$build" "$text"
+    cd - > /dev/null
+}
+
+printf '%-12.12s %10s %10s %10s %10s\n' "tree" "lines" "parse s" "-O2 s" "text B"
+
+measure "working" "$(pwd)"
+
+if [ -n "$1" ]; then
+    mkdir "$SCRATCH/tree"
+    git archive "$1" | tar -x -C "$SCRATCH/tree"
+    measure "$1" "$SCRATCH/tree"
+fi
@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Counts the allocations made by connecting a slot to a signal,
+ * and disconnecting it again, for each kind of target. The global
+ * operator new is replaced to count them.
+ */
+
+#include "src/hydrosig.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+
+static unsigned long g_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    g_allocations++;
+
+    void* memory = std::malloc(size != 0 ? size : 1);
+    if(memory == nullptr) throw std::bad_alloc();
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+struct receiver
+{
+    void receive(int /*value*/) { ; }
+};
+
+struct tracked_receiver : public hydrosig::trackable
+{
+    void receive(int /*value*/) { ; }
+};
+
+void receive(int /*value*/)
+{
+    ;
+}
+
+template<class Function>
+void count(const char *name, Function function)
+{
+    const unsigned int cycles = 10000;
+    unsigned long before = g_allocations;
+
+    for(unsigned int i = 0; i < cycles; ++i) function();
+
+    std::printf("%-24s %6.2f\n", name, double(g_allocations - before) / cycles);
+}
+
+int main()
+{
+    hydrosig::signal<void(int)> signal;
+    hydrosig::signal<void(int)> unconnected;
+    receiver plain;
+    tracked_receiver tracked;
+
+    // Keep other slots connected, so the array of slots is in use
+    for(int i = 0; i < 8; ++i) signal.connect(&receive);
+
+    signal.emit(0);
+
+    std::printf("%-24s %6s\n", "target", "allocs/cycle");
+
+    count("free function", [&]
+    {
+        signal.connect(&receive).disconnect();
+    });
+
+    count("member function", [&]
+    {
+        signal.connect(&plain, &receiver::receive).disconnect();
+    });
+
+    count("trackable member", [&]
+    {
+        signal.connect(&tracked, &tracked_receiver::receive).disconnect();
+    });
+
+    count("lambda (small)", [&]
+    {
+        signal.connect([](int /*value*/){ ; }).disconnect();
+    });
+
+    count("unconnected signal", [&]
+    {
+        unconnected.connect(&receive).disconnect();
+    });
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Measures disconnecting a random connection trough its handle and
+ * connecting a new slot in its place, as the number of slots grows,
+ * for each of the threading policies. Disconnecting trough the handle
+ * takes constant time, the lock-free policy still copies the array
+ * of slots when publishing the change.
+ */
+
+#include "bench/bench.h"
+#include "src/hydrosig.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+
+static long g_received = 0;
+
+void receive(int value)
+{
+    g_received += value;
+}
+
+template<class Threading_policy>
+double churn(unsigned int slots, unsigned int iterations)
+{
+    hydrosig::signal<void(int), Threading_policy> signal;
+    std::vector<hydrosig::connection<void(int)>> connections;
+
+    for(unsigned int i = 0; i < slots; ++i) connections.push_back(signal.connect(&receive));
+
+    std::mt19937 random(1);
+
+    return nanosecondsPer(iterations, [&]
+    {
+        hydrosig::connection<void(int)> &connection = connections[random() % slots];
+
+        connection.disconnect();
+        connection = signal.connect(&receive);
+    });
+}
+
+int main()
+{
+    std::printf("%8s %12s %12s %12s\n", "slots", "mutex", "single", "lock_free");
+
+    for(unsigned int slots : {10u, 1000u, 10000u})
+    {
+        std::printf("%8u %9.1f ns %9.1f ns %9.1f ns\n", slots,
+                    churn<hydrosig::mutex_threaded>(slots, 200000),
+                    churn<hydrosig::single_threaded>(slots, 200000),
+                    churn<hydrosig::lock_free_threaded>(slots, 2000000 / slots));
+    }
+
+    return 0;
+}
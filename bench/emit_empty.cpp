@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Measures emitting a signal whose only slot was disconnected,
+ * for each of the threading policies.
+ */
+
+#include "bench/bench.h"
+#include "src/hydrosig.h"
+
+#include <cstdio>
+
+
+void receive(int /*value*/)
+{
+    ;
+}
+
+template<class Threading_policy>
+void measure(const char *name)
+{
+    hydrosig::signal<void(int), Threading_policy> signal;
+
+    signal.connect(&receive).disconnect();
+
+    double time = nanosecondsPer(20000000, [&]{ signal.emit(1); });
+
+    std::printf("%-16s %8.1f\n", name, time);
+}
+
+int main()
+{
+    std::printf("%-16s %8s\n", "policy", "ns/emit");
+
+    measure<hydrosig::mutex_threaded>("mutex");
+    measure<hydrosig::single_threaded>("single");
+    measure<hydrosig::lock_free_threaded>("lock_free");
+    measure<hydrosig::shared_spinlock_threaded>("shared_spinlock");
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Measures emitting a signal, with one member function slot
+ * per receiver, as the number of slots grows.
+ */
+
+#include "bench/bench.h"
+#include "src/hydrosig.h"
+
+#include <cstdio>
+#include <vector>
+
+
+struct receiver
+{
+    int m_sum = 0;
+
+    void receive(int value) { m_sum += value; }
+};
+
+int main()
+{
+    std::printf("%8s %12s\n", "slots", "ns/emit");
+
+    for(unsigned int slots : {1u, 16u, 256u, 4096u})
+    {
+        std::vector<receiver> receivers(slots);
+        hydrosig::signal<void(int)> signal;
+
+        for(receiver &r : receivers) signal.connect(&r, &receiver::receive);
+
+        double time = nanosecondsPer(4000000 / slots + 1000, [&]{ signal.emit(1); });
+
+        std::printf("%8u %12.1f\n", slots, time);
+    }
+
+    return 0;
+}
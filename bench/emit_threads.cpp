@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Measures the aggregate throughput of emitting a signal with
+ * four slots from a growing number of threads, for each of the
+ * threading policies.
+ */
+
+#include "src/hydrosig.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+
+static std::atomic<unsigned long> g_activations(0);
+
+void receive(int value)
+{
+    g_activations.fetch_add(value, std::memory_order_relaxed);
+}
+
+template<class Threading_policy>
+void measure(const char *name)
+{
+    hydrosig::signal<void(int), Threading_policy> signal;
+
+    for(int i = 0; i < 4; ++i) signal.connect(&receive);
+
+    std::printf("%-16s", name);
+
+    for(unsigned int threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        std::atomic<bool> running(true);
+        std::atomic<unsigned long> emits(0);
+        std::vector<std::thread> emitters;
+
+        for(unsigned int i = 0; i < threads; ++i)
+        {
+            emitters.emplace_back([&]
+            {
+                unsigned long count = 0;
+
+                while(running.load(std::memory_order_relaxed))
+                {
+                    signal.emit(1);
+                    count++;
+                }
+
+                emits.fetch_add(count);
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        running.store(false);
+
+        for(std::thread &emitter : emitters) emitter.join();
+
+        // Millions of emissions per second
+        std::printf(" %7.1f", emits.load() / 200000.0);
+    }
+
+    std::printf("\n");
+}
+
+int main()
+{
+    std::printf("%-16s", "M emits/s");
+
+    for(unsigned int threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        std::printf(" %3u thr", threads);
+    }
+
+    std::printf("\n");
+
+    measure<hydrosig::mutex_threaded>("mutex");
+    measure<hydrosig::spinlock_threaded>("spinlock");
+    measure<hydrosig::shared_spinlock_threaded>("shared_spinlock");
+    measure<hydrosig::shared_mutex_threaded>("shared_mutex");
+    measure<hydrosig::lock_free_threaded>("lock_free");
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#pragma once
+#ifndef HYDROSIG_COMP_FUN_N_H_INCLUDED
+#define HYDROSIG_COMP_FUN_N_H_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+#include "src/functors/functor_n.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Function declarations:
+ * ----------------------
+ */
+
+/**
+ * @brief   Compares a functor_to_free_n with
+ *          another functor_n.
+ * @return  True if the functors are equal.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+bool comp_fun(functor_to_free_n<HYDROSIG_N_ARG> *rhs,
+              functor_n_base<HYDROSIG_N_ARG> *lhs);
+
+/**
+ * @brief   Compares a functor_to_member_n with
+ *          another functor_n.
+ * @details Functors of member functions with different
+ *          cv-qualifiers have different tags, and never
+ *          compare equal.
+ * @return  True if the functors are equal.
+ */
+template<class Object_type, class Function_type, class Return_type, class... Arg_types>
+bool comp_fun(functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG> *rhs,
+              functor_n_base<HYDROSIG_N_ARG> *lhs);
+
+
+
+
+/**
+ * Function definitions:
+ * --------------------
+ */
+
+HYDROSIG_TEMPLATE_N_ARG
+bool comp_fun(functor_to_free_n<HYDROSIG_N_ARG> *rhs,
+              functor_n_base<HYDROSIG_N_ARG> *lhs)
+{
+    // Comparing the tags of the functor types
+    if(lhs == nullptr || lhs->getTag() != rhs->getTag()) return false;
+
+    functor_to_free_n<HYDROSIG_N_ARG> *downCasted =
+            static_cast<functor_to_free_n<HYDROSIG_N_ARG>*>(lhs);
+
+    return (*downCasted == *rhs);
+}
+
+template<class Object_type, class Function_type, class Return_type, class... Arg_types>
+bool comp_fun(functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG> *rhs,
+              functor_n_base<HYDROSIG_N_ARG> *lhs)
+{
+    // Comparing the tags of the functor types
+    if(lhs == nullptr || lhs->getTag() != rhs->getTag()) return false;
+
+    functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG> *downCasted =
+            static_cast<functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG>*>(lhs);
+
+    return (*downCasted == *rhs);
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_COMP_FUN_N_H_INCLUDED
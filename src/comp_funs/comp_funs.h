@@ -27,14 +27,6 @@
  *
  */
 
-#include "src/comp_funs/comp_fun_0.h"
-#include "src/comp_funs/comp_fun_1.h"
-#include "src/comp_funs/comp_fun_2.h"
-#include "src/comp_funs/comp_fun_3.h"
-#include "src/comp_funs/comp_fun_4.h"
-#include "src/comp_funs/comp_fun_5.h"
-#include "src/comp_funs/comp_fun_6.h"
-#include "src/comp_funs/comp_fun_7.h"
-#include "src/comp_funs/comp_fun_8.h"
+#include "src/comp_funs/comp_fun_n.h"
 
 #endif // HYDROSIG_COMP_FUNS_H_INCLUDED
@@ -47,6 +47,8 @@
  * support is needed. In single threaded applications
  * it is better not to define this macro, to avoid
  * the overhead of unnecessary synchronisation.
+ * Signals synchronise according to their threading
+ * policy, this macro only selects the default one.
  ****************************************************/
 #define HYDROSIG_SYNCHRONISE_THREADS
 
@@ -60,6 +62,46 @@
  ****************************************************/
 ///#define HYDROSIG_HYDROGEN_AVAILABLE
 
+/*****************************************************
+ * Enables lock-free emission of signals by default.
+ * If this macro is defined, emitting a signal never
+ * blocks on other emissions, nor on connection
+ * management, at the cost of copying the connected
+ * slots and waiting for running emissions to release
+ * them on every connection and disconnection. Define
+ * this macro if signals are emitted frequently from
+ * many threads, and connected to only rarely. Has
+ * effect only if HYDROSIG_SYNCHRONISE_THREADS is
+ * defined. Individual signals may select lock-free
+ * emission with the lock_free_threaded policy.
+ ****************************************************/
+///#define HYDROSIG_LOCK_FREE_EMISSION
+
+/*****************************************************
+ * Defines the number of slots a signal stores inside
+ * the signal object itself. Connecting the first few
+ * slots then allocates no storage for the list of
+ * slots, but emission copies them one by one instead
+ * of sharing a single array. The slots are moved to
+ * a heap array once more are connected. Define it as
+ * 1 to 4 if signals are connected and disconnected
+ * frequently, but have only a few slots. Signals
+ * emitting without locking always use the heap array.
+ ****************************************************/
+#define HYDROSIG_INLINE_SLOT_COUNT 0
+
+/*****************************************************
+ * Defines the size in bytes of callable objects,
+ * such as lambda-expressions, which slots store
+ * inside themselves. Connecting a larger callable
+ * object allocates a copy of it on the heap. Slots
+ * always have room for a pointer to an object and
+ * a pointer to a member function, this macro can
+ * only enlarge them. Define it larger if callables
+ * capturing more state are connected frequently.
+ ****************************************************/
+#define HYDROSIG_CALLABLE_BUFFER_SIZE (2 * sizeof(void*))
+
 
 
 
@@ -77,6 +119,15 @@
 # define HYDROSIG_LIST_TYPE          std::list
 #endif
 
+/*******************************************************
+ * Defines the vector-type used in the library.
+ ******************************************************/
+#ifdef  HYDROSIG_HYDROGEN_AVAILABLE
+# define HYDROSIG_VECTOR_TYPE        HVector
+#else
+# define HYDROSIG_VECTOR_TYPE        std::vector
+#endif
+
 /*******************************************************
  * Defines the shared_ptr type used in the library.
  ******************************************************/
@@ -114,13 +165,20 @@
 #endif
 
 /****************************************************************************
- * Defines the lock-guard type used in the library.
+ * Defines the threading policy of signals which do not specify one.
  ***************************************************************************/
-#ifdef  HYDROSIG_HYDROGEN_AVAILABLE
-# define HYDROSIG_LOCK_GUARD_TYPE    HMutexLocker
+#if     defined(HYDROSIG_SYNCHRONISE_THREADS) && defined(HYDROSIG_LOCK_FREE_EMISSION)
+# define HYDROSIG_DEFAULT_THREADING_POLICY    lock_free_threaded
+#elif   defined(HYDROSIG_SYNCHRONISE_THREADS)
+# define HYDROSIG_DEFAULT_THREADING_POLICY    mutex_threaded
 #else
-# define HYDROSIG_LOCK_GUARD_TYPE    std::unique_lock<std::recursive_mutex>
+# define HYDROSIG_DEFAULT_THREADING_POLICY    single_threaded
 #endif
 
+/****************************************************************************
+ * Defines the allocator of signals which do not specify one.
+ ***************************************************************************/
+#define HYDROSIG_DEFAULT_ALLOCATOR    std::allocator<void>
+
 
 #endif // HYDROSIG_CONFIG_H_INCLUDED
@@ -31,6 +31,7 @@
 
 #include "src/macros.h"
 #include "src/trackable/trackable.h"
+#include "src/slots/slot_base/slot_base.h"
 
 
 HYDROSIG_NAMESPACE_BEGIN
@@ -50,6 +51,10 @@ HYDROSIG_NAMESPACE_BEGIN
  *          provides virtual methods for accessing the
  *          blocking mechanism and validation of the
  *          represented slot object.
+ *          Connections are handles with value semantics, and
+ *          carry no mutex: copies of a connection may be used
+ *          on different threads, but a single connection must
+ *          not be assigned to while it is used elsewhere.
  */
 class connection_base
 {
@@ -64,7 +69,7 @@ public:
      *          connection_validator.
      * @param   validator The connection_validator to use.
      */
-    connection_base(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator);
+    connection_base(HYDROSIG_WEAK_PTR_TYPE<connection_validator> validator);
 
     /**
      * @brief   Returns whether the represented slot is connected.
@@ -94,12 +99,31 @@ public:
      */
     virtual bool isBlocked() const = 0;
 
+    /**
+     * @brief   Returns the concurrency policy of the represented slot.
+     * @return  The concurrency policy of the slot.
+     */
+    virtual concurrency_policy getConcurrencyPolicy() const = 0;
+
+    /**
+     * @brief   Sets the concurrency policy of the represented slot.
+     * @param   policy The concurrency policy to set.
+     */
+    virtual void setConcurrencyPolicy(concurrency_policy policy) = 0;
+
 protected:
-    /**< The connection validator of the represented slot */
-    HYDROSIG_SHARED_PTR_TYPE<connection_validator> m_validator;
+    /**
+     * @brief   Returns whether this connection represents the
+     *          same slot as another.
+     * @details Validators are compared by the slots owning
+     *          them, which works after the slot is destroyed.
+     * @param   rhs The other connection.
+     * @return  True if the connections represent the same slot.
+     */
+    bool isSameConnection(const connection_base &rhs) const;
 
-    /**< Mutex used for synchronisation */
-    mutable HYDROSIG_MUTEX_TYPE m_mutex;
+    /**< The connection validator of the represented slot */
+    HYDROSIG_WEAK_PTR_TYPE<connection_validator> m_validator;
 
 };
 
@@ -120,6 +144,23 @@ public:
 
 };
 
+/**
+ * @brief   This class represents an activation failure exception,
+ *          which is thrown by connections, when the represented
+ *          slot is activated after it was disconnected, or after
+ *          its tracked object was destroyed.
+ */
+class activation_failure : public std::exception
+{
+public:
+    /**
+     * @brief   Returns an explanatory string about the exception.
+     * @return  The explanatory string.
+     */
+    virtual const char* what() const noexcept;
+
+};
+
 
 
 
@@ -129,13 +170,13 @@ public:
  */
 
 inline connection_base::connection_base()
-    : m_validator(nullptr)
+    : m_validator()
 {
     ;
 }
 
 inline connection_base::connection_base(
-        HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator)
+        HYDROSIG_WEAK_PTR_TYPE<connection_validator> validator)
     : m_validator(validator)
 {
     ;
@@ -143,7 +184,18 @@ inline connection_base::connection_base(
 
 inline bool connection_base::isConnected() const
 {
-    return m_validator->isValid();
+    // The validator expires with the slot holding it
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator = m_validator.lock();
+
+    if(validator == nullptr) return false;
+
+    return validator->isValid();
+}
+
+inline bool connection_base::isSameConnection(const connection_base &rhs) const
+{
+    return (!m_validator.owner_before(rhs.m_validator) &&
+            !rhs.m_validator.owner_before(m_validator));
 }
 
 inline const char* connection_failure::what() const noexcept
@@ -151,6 +203,11 @@ inline const char* connection_failure::what() const noexcept
         return "Hydrosig: Signal connection failed.";
 }
 
+inline const char* activation_failure::what() const noexcept
+{
+        return "Hydrosig: Slot activation failed.";
+}
+
 
 HYDROSIG_NAMESPACE_END
 
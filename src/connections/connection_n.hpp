@@ -0,0 +1,702 @@
+#pragma once
+#ifndef HYDROSIG_CONNECTION_N_HPP_INCLUDED
+#define HYDROSIG_CONNECTION_N_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+#include "src/connections/connection_base/connection_base.h"
+#include "src/slots/slot_n.hpp"
+#include "src/signals/signal_n.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Forward declarations:
+ * ---------------------
+ */
+
+template<class Signature>
+class connection_n;
+
+template<class Signature>
+class scoped_connection_n;
+
+
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class represents signal-slot connections,
+ *          with any number of arguments.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+class connection_n<HYDROSIG_N_ARG> : public connection_base
+{
+    /**< Friend declaration for scoped_connections */
+    friend class scoped_connection_n<HYDROSIG_N_ARG>;
+
+public:
+    /**< Typedef for the slot type */
+    typedef slot_n<HYDROSIG_N_ARG> slot_type;
+
+    /**< Typedef for the signal type */
+    typedef signal_base signal_type;
+
+    /**
+     * @brief   Constructs a connection_n object from the
+     *          given slot pointer, signal pointer and validator.
+     * @param   slot_ptr Pointer to the slot to represent.
+     * @param   signal_ptr Pointer to the represented slot's
+     *                     holder signal.
+     * @param   validator The validator of the represented slot.
+     */
+    connection_n(HYDROSIG_WEAK_PTR_TYPE<slot_type> slot_ptr,
+                 signal_type *signal_ptr,
+                 HYDROSIG_WEAK_PTR_TYPE<connection_validator> validator);
+
+    /**
+     * @brief   Constructs a connection_n by copying src.
+     * @param   src The connection to copy.
+     */
+    connection_n(const connection_n &src);
+
+    /**
+     * @brief   Constructs a connection_n by moving src.
+     * @details Note that src should not be used after the move.
+     * @param   src The connection to move.
+     */
+    connection_n(connection_n &&src);
+
+    /**
+     * @brief   Destroys the connection_n object.
+     */
+    virtual ~connection_n();
+
+    /**
+     * @brief   Copy assigns src to this connection_n.
+     * @param   src The connection object to copy.
+     */
+    connection_n& operator=(const connection_n &src);
+
+    /**
+     * @brief   Move assigns src to this connection_n.
+     * @param   src The connection object to move.
+     * @details Note that src should not be used after the move.
+     */
+    connection_n& operator=(connection_n &&src);
+
+    /**
+     * @brief   Returns whether the represented slot is disconnected.
+     * @return  True if the slot is disconnected.
+     */
+    bool isConnected() const;
+
+    /**
+     * @brief   Disconnects the represented slot from the signal.
+     */
+    void disconnect() const;
+
+    /**
+     * @brief   Sets the blocking state of the represented slot.
+     * @param   shouldBlock The state of blocking.
+     */
+    void block(bool shouldBlock = true);
+
+    /**
+     * @brief   Unblocks the represented slot.
+     */
+    void unblock();
+
+    /**
+     * @brief   Returns whether the represented
+     *          slot is blocked.
+     * @return  True if the slot is blocked.
+     */
+    bool isBlocked() const;
+
+    /**
+     * @brief   Returns the concurrency policy of the
+     *          represented slot.
+     * @return  The concurrency policy of the slot.
+     */
+    concurrency_policy getConcurrencyPolicy() const;
+
+    /**
+     * @brief   Sets the concurrency policy of the
+     *          represented slot.
+     * @details Has no effect if the connection is
+     *          disconnected.
+     * @param   policy The concurrency policy to set.
+     */
+    void setConcurrencyPolicy(concurrency_policy policy);
+
+    /**
+     * @brief   Activates the represented slot.
+     * @details The concurrency policy of the slot is
+     *          applied, except that busy skip_if_busy
+     *          slots are waited for instead of skipped.
+     *          Throws activation_failure if the slot was
+     *          destroyed by disconnecting it, or its
+     *          tracked object was destroyed.
+     * @param   args The arguments.
+     * @return  The result of the slot activation.
+     */
+    Return_type activate(Arg_types... args);
+
+    /**
+     * @brief   Activates the represented slot.
+     * @details This is a convenience operator,
+     *          which calls activate(), and throws
+     *          activation_failure the same way.
+     * @param   args The arguments.
+     * @return  The result of the slot activation.
+     */
+    Return_type operator()(Arg_types... args);
+
+    /**
+     * @brief   Swaps this connection_n with another.
+     * @param   src The other connection_n object.
+     */
+    void swap(connection_n &src);
+
+    /**
+     * @brief   Compares this connection_n with another
+     *          for equality.
+     * @param   rhs The other connection_n object.
+     * @return  True if connections are equal.
+     */
+    bool operator==(const connection_n &rhs);
+
+    /**
+     * @brief   Compares this connection_n with another
+     *          for unequality.
+     * @param   rhs The other connection_n object.
+     * @return  True if connections are unequal.
+     */
+    bool operator!=(const connection_n &rhs);
+
+protected:
+    /**< Pointer to the represented slot */
+    HYDROSIG_WEAK_PTR_TYPE<slot_type> m_slot;
+
+    /**< Pointer to the represented slot's holder signal */
+    signal_type* m_signal;
+
+};
+
+/**
+ * @brief   This class represents signal-slot connections,
+ *          with any number of arguments, which will be
+ *          automatically disconnected when the
+ *          scoped_connection object is destroyed.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+class scoped_connection_n<HYDROSIG_N_ARG> : public connection_n<HYDROSIG_N_ARG>
+{
+public:
+    /**
+     * @brief   Copies an existing connection object to manage
+     *          the scope of it's connection.
+     * @param   src The connection object to copy.
+     */
+    scoped_connection_n(const connection_n<HYDROSIG_N_ARG> &src);
+
+    /**
+     * @brief   Constructs a scoped_connection_n by moving src.
+     * @details Note that src should not be used after the move.
+     * @param   src The connection object to move.
+     */
+    scoped_connection_n(scoped_connection_n &&src);
+
+    /**
+     * @brief   Constructs a scoped_connection_n by moving src.
+     * @details Note that src should not be used after the move.
+     * @param   src The connection object to move.
+     */
+    scoped_connection_n(connection_n<HYDROSIG_N_ARG> &&src);
+
+    /**
+     * @brief   Destroys the scoped_connection_n object.
+     * @details The represented slot will also be disconnected
+     *          from the holder signal.
+     */
+    ~scoped_connection_n();
+
+    /**
+     * @brief   Copies an existing connection object to manage
+     *          the scope of it's connection.
+     * @return  src The connection object to copy.
+     */
+    scoped_connection_n& operator=(const connection_n<HYDROSIG_N_ARG> &src);
+
+    /**
+     * @brief   Copy assignment of a scoped_connection_n is disabled.
+     */
+    scoped_connection_n& operator=(const scoped_connection_n& /*src*/) = delete;
+
+    /**
+     * @brief   Move assigns src to this scoped_connection_n.
+     * @details Note that src should not be used after the move.
+     * @param   src The connection object to move.
+     */
+    scoped_connection_n& operator=(scoped_connection_n &&src);
+
+    /**
+     * @brief   Move assigns src to this scoped_connection_n.
+     * @details Note that src should not be used after the move.
+     * @param   src The connection object to move.
+     */
+    scoped_connection_n& operator=(connection_n<HYDROSIG_N_ARG> &&src);
+
+    /**
+     * @brief   Releases the connection and returns a normal
+     *          connection object.
+     * @details The scoped_connection_n will be reset, and
+     *          will not disconnect the connection upon
+     *          destruction.
+     * @return  A connection_n object, referring the connection.
+     */
+    connection_n<HYDROSIG_N_ARG> release();
+
+};
+
+
+
+
+/**
+ * Function declarations:
+ * ----------------------
+ */
+
+/**
+ * @brief   Swaps two connection_n objects.
+ * @param   lhs The left side operand.
+ * @param   rhs The right side operand.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+void swap(connection_n<HYDROSIG_N_ARG> &lhs,
+          connection_n<HYDROSIG_N_ARG> &rhs);
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG>::connection_n(
+        HYDROSIG_WEAK_PTR_TYPE<slot_type> slot_ptr,
+        signal_type *signal_ptr,
+        HYDROSIG_WEAK_PTR_TYPE<connection_validator> validator)
+    : connection_base(validator),
+      m_slot(slot_ptr),
+      m_signal(signal_ptr)
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG>::connection_n(const connection_n &src)
+    : connection_base(src.m_validator),
+      m_slot(src.m_slot),
+      m_signal(src.m_signal)
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG>::connection_n(connection_n &&src)
+    : connection_base(std::move(src.m_validator)),
+      m_slot(std::move(src.m_slot)),
+      m_signal(std::move(src.m_signal))
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG>::~connection_n()
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG>& connection_n<HYDROSIG_N_ARG>::operator=(
+        const connection_n &src)
+{
+    if(this == &src) return *this;
+
+    m_validator = src.m_validator;
+    m_slot = src.m_slot;
+    m_signal = src.m_signal;
+
+    return *this;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG>& connection_n<HYDROSIG_N_ARG>::operator=(
+        connection_n &&src)
+{
+    if(this == &src) return *this;
+
+    m_validator = std::move(src.m_validator);
+    m_slot = std::move(src.m_slot);
+    m_signal = std::move(src.m_signal);
+
+    return *this;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+bool connection_n<HYDROSIG_N_ARG>::isConnected() const
+{
+    return connection_base::isConnected();
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+void connection_n<HYDROSIG_N_ARG>::disconnect() const
+{
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+    if(!isConnected() || slot == nullptr) return;
+
+    m_signal->disconnect(slot.get());
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+void connection_n<HYDROSIG_N_ARG>::block(bool shouldBlock)
+{
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+    if(!isConnected() || slot == nullptr) return;
+
+    slot->block(shouldBlock);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+void connection_n<HYDROSIG_N_ARG>::unblock()
+{
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+    if(!isConnected() || slot == nullptr) return;
+
+    slot->unblock();
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+bool connection_n<HYDROSIG_N_ARG>::isBlocked() const
+{
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+    if(!isConnected() || slot == nullptr) return true;
+
+    return slot->isBlocked();
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+concurrency_policy connection_n<HYDROSIG_N_ARG>::getConcurrencyPolicy() const
+{
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+    if(!isConnected() || slot == nullptr) return concurrency_policy::reentrant;
+
+    return slot->getConcurrencyPolicy();
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+void connection_n<HYDROSIG_N_ARG>::setConcurrencyPolicy(concurrency_policy policy)
+{
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+    if(!isConnected() || slot == nullptr) return;
+
+    slot->setConcurrencyPolicy(policy);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+Return_type connection_n<HYDROSIG_N_ARG>::activate(
+        Arg_types... args)
+{
+    try {
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> slot = m_slot.lock();
+
+        if(slot == nullptr) throw activation_failure();
+
+        slot_base::activation_guard activation(*slot, false);
+
+        // The tracked object is destroyed, or being destroyed
+        if(!activation.isActive()) throw activation_failure();
+
+        return slot->activate(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+Return_type connection_n<HYDROSIG_N_ARG>::operator()(
+        Arg_types... args)
+{
+    try {
+        return activate(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+void connection_n<HYDROSIG_N_ARG>::swap(connection_n &src)
+{
+    std::swap(m_validator, src.m_validator);
+    std::swap(m_slot, src.m_slot);
+    std::swap(m_signal, src.m_signal);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+bool connection_n<HYDROSIG_N_ARG>::operator==(const connection_n &rhs)
+{
+    return isSameConnection(rhs);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+bool connection_n<HYDROSIG_N_ARG>::operator!=(const connection_n &rhs)
+{
+    return !isSameConnection(rhs);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>::scoped_connection_n(
+        const connection_n<HYDROSIG_N_ARG> &src)
+    : connection_n<HYDROSIG_N_ARG>(src.m_slot,
+                                   src.m_signal,
+                                   src.m_validator)
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>::scoped_connection_n(
+        scoped_connection_n &&src)
+    : connection_n<HYDROSIG_N_ARG>(std::move(src.m_slot),
+                                   std::move(src.m_signal),
+                                   std::move(src.m_validator))
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>::scoped_connection_n(
+        connection_n<HYDROSIG_N_ARG> &&src)
+    : connection_n<HYDROSIG_N_ARG>(std::move(src.m_slot),
+                                   std::move(src.m_signal),
+                                   std::move(src.m_validator))
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>::~scoped_connection_n()
+{
+    this->disconnect();
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>& scoped_connection_n<HYDROSIG_N_ARG>::operator=(
+        const connection_n<HYDROSIG_N_ARG> &src)
+{
+    if(this == &src) return *this;
+
+    connection_n<HYDROSIG_N_ARG>::operator=(src);
+
+    return *this;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>& scoped_connection_n<HYDROSIG_N_ARG>::operator=(
+        scoped_connection_n &&src)
+{
+    if(this == &src) return *this;
+
+    connection_n<HYDROSIG_N_ARG>::operator=(
+                std::forward<connection_n<HYDROSIG_N_ARG>>(src));
+
+    return *this;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+scoped_connection_n<HYDROSIG_N_ARG>& scoped_connection_n<HYDROSIG_N_ARG>::operator=(
+        connection_n<HYDROSIG_N_ARG> &&src)
+{
+    if(this == &src) return *this;
+
+    connection_n<HYDROSIG_N_ARG>::operator=(
+                std::forward<connection_n<HYDROSIG_N_ARG>>(src));
+
+    return *this;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+connection_n<HYDROSIG_N_ARG> scoped_connection_n<HYDROSIG_N_ARG>::release()
+{
+    connection_n<HYDROSIG_N_ARG> released(this->m_slot,
+                                          this->m_signal,
+                                          this->m_validator);
+
+    this->m_validator.reset();
+    this->m_signal = nullptr;
+    this->m_slot.reset();
+
+    return released;
+}
+
+
+
+
+/**
+ * Function definitions:
+ * ---------------------
+ */
+
+HYDROSIG_TEMPLATE_N_ARG
+void swap(connection_n<HYDROSIG_N_ARG> &lhs,
+          connection_n<HYDROSIG_N_ARG> &rhs)
+{
+    lhs.swap(rhs);
+}
+
+
+
+/**
+ * Fixed arity aliases:
+ * --------------------
+ * Kept for code written against the per-arity connection templates.
+ */
+
+/**
+ * @brief   Connection and scoped_connection with no arguments.
+ */
+HYDROSIG_TEMPLATE_0_ARG
+using connection_0 = connection_n<Return_type()>;
+
+HYDROSIG_TEMPLATE_0_ARG
+using scoped_connection_0 = scoped_connection_n<Return_type()>;
+
+/**
+ * @brief   Connection and scoped_connection with one argument.
+ */
+HYDROSIG_TEMPLATE_1_ARG
+using connection_1 = connection_n<Return_type(Arg1_type)>;
+
+HYDROSIG_TEMPLATE_1_ARG
+using scoped_connection_1 = scoped_connection_n<Return_type(Arg1_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with two arguments.
+ */
+HYDROSIG_TEMPLATE_2_ARG
+using connection_2 = connection_n<Return_type(Arg1_type, Arg2_type)>;
+
+HYDROSIG_TEMPLATE_2_ARG
+using scoped_connection_2 = scoped_connection_n<Return_type(Arg1_type, Arg2_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with three arguments.
+ */
+HYDROSIG_TEMPLATE_3_ARG
+using connection_3 = connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+HYDROSIG_TEMPLATE_3_ARG
+using scoped_connection_3 = scoped_connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with four arguments.
+ */
+HYDROSIG_TEMPLATE_4_ARG
+using connection_4 = connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+HYDROSIG_TEMPLATE_4_ARG
+using scoped_connection_4 = scoped_connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with five arguments.
+ */
+HYDROSIG_TEMPLATE_5_ARG
+using connection_5 = connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                              Arg5_type)>;
+
+HYDROSIG_TEMPLATE_5_ARG
+using scoped_connection_5 = scoped_connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with six arguments.
+ */
+HYDROSIG_TEMPLATE_6_ARG
+using connection_6 = connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                              Arg5_type, Arg6_type)>;
+
+HYDROSIG_TEMPLATE_6_ARG
+using scoped_connection_6 = scoped_connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type, Arg6_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with seven arguments.
+ */
+HYDROSIG_TEMPLATE_7_ARG
+using connection_7 = connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                              Arg5_type, Arg6_type, Arg7_type)>;
+
+HYDROSIG_TEMPLATE_7_ARG
+using scoped_connection_7 = scoped_connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type, Arg6_type, Arg7_type)>;
+
+/**
+ * @brief   Connection and scoped_connection with eight arguments.
+ */
+HYDROSIG_TEMPLATE_8_ARG
+using connection_8 = connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                              Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+HYDROSIG_TEMPLATE_8_ARG
+using scoped_connection_8 = scoped_connection_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_CONNECTION_N_HPP_INCLUDED
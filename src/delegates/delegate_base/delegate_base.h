@@ -0,0 +1,634 @@
+#pragma once
+#ifndef HYDROSIG_DELEGATE_BASE_H_INCLUDED
+#define HYDROSIG_DELEGATE_BASE_H_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "src/macros.h"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template is the target of delegates
+ *          bound to a member function of an object.
+ */
+template<class Object_type, class Function_type>
+struct bound_member
+{
+    /**< Pointer to the target object */
+    Object_type*  m_object;
+
+    /**< Pointer to the member function */
+    Function_type m_function;
+
+    /**
+     * @brief   Compares this target with another for equality.
+     * @details Two targets compare equal, if they refer to the
+     *          same member function of the same object.
+     * @param   other The other target.
+     * @return  True if the targets compare equal.
+     */
+    bool operator==(const bound_member &other) const;
+
+    /**
+     * @brief   Returns the hash of this target.
+     * @details Targets comparing equal have the same hash.
+     * @return  The hash of the target.
+     */
+    std::size_t hash() const;
+};
+
+/**
+ * @brief   This class forms the base of delegates, which hold
+ *          the target of a slot by value, and call it trough a
+ *          single function pointer.
+ * @details The target (a function pointer, an object pointer
+ *          with a member function pointer, or a callable object
+ *          of at most HYDROSIG_CALLABLE_BUFFER_SIZE bytes) is
+ *          stored inside the delegate. Larger callable objects
+ *          are allocated on the heap, trough the allocator given
+ *          upon construction. The
+ *          typed operations needed to destroy, move and compare
+ *          targets are provided by a single manager function,
+ *          which is selected upon construction, so delegates
+ *          need neither virtual functions nor RTTI.
+ */
+class delegate_base
+{
+public:
+    /**
+     * @brief   Destroys the delegate, and its target.
+     */
+    ~delegate_base();
+
+    /**
+     * @brief   Compares this delegate with another for equality.
+     * @details Two delegates compare equal, if their targets have
+     *          the same type, and compare equal. Delegates with
+     *          callable objects as targets never compare equal.
+     * @param   other The other delegate.
+     * @return  True if the delegates compare equal.
+     */
+    bool operator==(const delegate_base &other) const;
+
+    /**
+     * @brief   Compares this delegate with another for inequality.
+     * @param   other The other delegate.
+     * @return  True if the delegates do not compare equal.
+     */
+    bool operator!=(const delegate_base &other) const;
+
+    /**
+     * @brief   Returns the hash of the target of the delegate.
+     * @details Delegates comparing equal have the same hash.
+     *          Delegates which never compare equal (callable
+     *          objects, or no target) have 0 as their hash,
+     *          and no other delegate does.
+     * @return  The hash of the target, or 0.
+     */
+    std::size_t hash() const;
+
+    /**< The initial value of hashes */
+    static const std::size_t hash_seed =
+            (sizeof(std::size_t) > 4 ? 14695981039346656037ULL : 2166136261UL);
+
+    /**< The multiplier of hashes */
+    static const std::size_t hash_prime =
+            (sizeof(std::size_t) > 4 ? 1099511628211ULL : 16777619UL);
+
+    /**
+     * @brief   Hashes the given bytes.
+     * @param   bytes Pointer to the bytes.
+     * @param   count The number of bytes.
+     * @param   seed The hash to continue from.
+     * @return  The hash of the bytes.
+     */
+    static std::size_t hashBytes(const void* bytes,
+                                 std::size_t count,
+                                 std::size_t seed = hash_seed);
+
+protected:
+    /**
+     * @brief   This enum lists the operations of managers.
+     */
+    enum class operation
+    {
+        destroy,    /**< Destroys the target */
+        move,       /**< Move constructs the target from the other */
+        compare,    /**< Compares the target with the other */
+        hash        /**< Writes the hash of the target into the other */
+    };
+
+    /**< Class used for sizing member function pointers */
+    class undefined_class;
+
+    /**< Size of bound member function targets */
+    static const std::size_t member_size =
+            sizeof(void*) + sizeof(void(undefined_class::*)());
+
+    /**< Typedef for the storage of the target */
+    typedef std::aligned_storage<(member_size > HYDROSIG_CALLABLE_BUFFER_SIZE ?
+                                  member_size : HYDROSIG_CALLABLE_BUFFER_SIZE),
+                                 alignof(void*)>::type
+    storage_type;
+
+    /**
+     * @brief   This class template is the heap block of callable
+     *          objects not stored inside the delegate.
+     * @details The allocator of the block is kept next to the
+     *          callable object, to deallocate the block with.
+     */
+    template<class Callable_type, class Allocator_type>
+    struct heap_callable
+    {
+        /**< The callable object */
+        Callable_type  m_callable;
+
+        /**< The allocator of the block */
+        Allocator_type m_allocator;
+    };
+
+    /**
+     * @brief   This class template is stored inside the delegate
+     *          for callable objects allocated on the heap.
+     * @details Invokers only need the callable object, while the
+     *          manager needs the block it is allocated in.
+     */
+    template<class Callable_type>
+    struct heap_target
+    {
+        /**< Pointer to the callable object */
+        Callable_type* m_callable;
+
+        /**< Pointer to the heap block of the callable object */
+        void*          m_block;
+    };
+
+    /**
+     * @brief   This trait tells whether a callable object is
+     *          stored inside the delegate.
+     * @details Callable objects are stored inside, if they fit
+     *          into the storage and can be moved without throwing.
+     */
+    template<class Callable_type>
+    struct stored_locally : std::integral_constant<bool,
+            sizeof(Callable_type) <= sizeof(storage_type) &&
+            alignof(Callable_type) <= alignof(storage_type) &&
+            std::is_nothrow_move_constructible<Callable_type>::value>
+    {};
+
+    /**< Typedef for the manager of the target */
+    typedef bool(*manager_type)(operation op,
+                                storage_type &target,
+                                storage_type *other);
+
+    /**
+     * @brief   Constructs a delegate without target.
+     */
+    delegate_base();
+
+    /**
+     * @brief   Constructs a delegate by moving the target of src.
+     * @param   src The delegate to move.
+     */
+    delegate_base(delegate_base&& src);
+
+    /**
+     * @brief   Copy constructing a delegate is disallowed.
+     */
+    delegate_base(const delegate_base& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a delegate is disallowed.
+     */
+    delegate_base& operator=(const delegate_base& /*src*/) = delete;
+
+    /**
+     * @brief   Stores a comparable target, such as a function
+     *          pointer or a bound_member, inside the delegate.
+     * @param   target The target to store.
+     */
+    template<class Target_type>
+    void store(const Target_type &target);
+
+    /**
+     * @brief   Stores a callable object as the target of the
+     *          delegate, allocating it on the heap if it is
+     *          not stored locally.
+     * @param   callable The callable object to store.
+     * @param   allocator The allocator of the heap block.
+     */
+    template<class Callable_type, class Allocator_type>
+    void storeCallable(Callable_type callable, const Allocator_type &allocator);
+
+    /**
+     * @brief   Returns the target stored inside the delegate.
+     * @return  Reference to the target.
+     */
+    template<class Target_type>
+    static Target_type& target(storage_type &storage);
+
+    /**
+     * @brief   Returns the callable object stored as the target
+     *          of the delegate, either locally or on the heap.
+     * @return  Reference to the callable object.
+     */
+    template<class Callable_type>
+    static Callable_type& callableTarget(storage_type &storage);
+
+    /**
+     * @brief   Manager of comparable targets stored by value.
+     */
+    template<class Target_type>
+    static bool manageTarget(operation op,
+                             storage_type &target,
+                             storage_type *other);
+
+    /**
+     * @brief   Returns the hash of a target stored by value.
+     */
+    template<class Target_type>
+    static std::size_t hashTarget(const Target_type &target);
+
+    /**
+     * @brief   Returns the hash of a bound member function target.
+     */
+    template<class Object_type, class Function_type>
+    static std::size_t hashTarget(const bound_member<Object_type, Function_type> &target);
+
+    /**
+     * @brief   Manager of callable objects stored locally.
+     */
+    template<class Callable_type>
+    static bool manageLocalCallable(operation op,
+                                    storage_type &target,
+                                    storage_type *other);
+
+    /**
+     * @brief   Manager of callable objects stored on the heap.
+     */
+    template<class Callable_type, class Allocator_type>
+    static bool manageHeapCallable(operation op,
+                                   storage_type &target,
+                                   storage_type *other);
+
+    /**
+     * @brief   Stores a callable object locally.
+     */
+    template<class Callable_type, class Allocator_type>
+    void storeCallable(Callable_type &callable,
+                       const Allocator_type &allocator,
+                       std::true_type);
+
+    /**
+     * @brief   Stores a callable object on the heap.
+     */
+    template<class Callable_type, class Allocator_type>
+    void storeCallable(Callable_type &callable,
+                       const Allocator_type &allocator,
+                       std::false_type);
+
+    /**
+     * @brief   Returns a callable object stored locally.
+     */
+    template<class Callable_type>
+    static Callable_type& callableTarget(storage_type &storage,
+                                         std::true_type);
+
+    /**
+     * @brief   Returns a callable object stored on the heap.
+     */
+    template<class Callable_type>
+    static Callable_type& callableTarget(storage_type &storage,
+                                         std::false_type);
+
+    /**< The storage of the target */
+    storage_type m_storage;
+
+    /**< The manager of the target, nullptr if there is none */
+    manager_type m_manager;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Object_type, class Function_type>
+bool bound_member<Object_type, Function_type>::operator==(
+        const bound_member &other) const
+{
+    return (m_object == other.m_object && m_function == other.m_function);
+}
+
+template<class Object_type, class Function_type>
+std::size_t bound_member<Object_type, Function_type>::hash() const
+{
+    // The members are hashed one by one, to skip any padding
+    return delegate_base::hashBytes(&m_function, sizeof(m_function),
+           delegate_base::hashBytes(&m_object, sizeof(m_object)));
+}
+
+inline delegate_base::delegate_base()
+    : m_manager(nullptr)
+{
+    ;
+}
+
+inline delegate_base::delegate_base(delegate_base&& src)
+    : m_manager(src.m_manager)
+{
+    if(m_manager != nullptr)
+    {
+        m_manager(operation::move, m_storage, &src.m_storage);
+    }
+}
+
+inline delegate_base::~delegate_base()
+{
+    if(m_manager != nullptr)
+    {
+        m_manager(operation::destroy, m_storage, nullptr);
+    }
+}
+
+inline bool delegate_base::operator==(const delegate_base &other) const
+{
+    if(m_manager == nullptr || m_manager != other.m_manager) return false;
+
+    return m_manager(operation::compare,
+                     const_cast<storage_type&>(m_storage),
+                     const_cast<storage_type*>(&other.m_storage));
+}
+
+inline bool delegate_base::operator!=(const delegate_base &other) const
+{
+    return !(*this == other);
+}
+
+inline std::size_t delegate_base::hash() const
+{
+    storage_type result;
+
+    if(m_manager == nullptr ||
+       !m_manager(operation::hash,
+                  const_cast<storage_type&>(m_storage),
+                  &result))
+    {
+        return 0;
+    }
+
+    return target<std::size_t>(result);
+}
+
+inline std::size_t delegate_base::hashBytes(const void* bytes,
+                                            std::size_t count,
+                                            std::size_t seed)
+{
+    // FNV-1a
+    const unsigned char* it = static_cast<const unsigned char*>(bytes);
+    std::size_t hash = seed;
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        hash ^= it[i];
+        hash *= hash_prime;
+    }
+
+    return hash;
+}
+
+template<class Target_type>
+void delegate_base::store(const Target_type &target)
+{
+    static_assert(sizeof(Target_type) <= sizeof(storage_type) &&
+                  alignof(Target_type) <= alignof(storage_type),
+                  "The target does not fit into the delegate.");
+
+    new(&m_storage) Target_type(target);
+    m_manager = &manageTarget<Target_type>;
+}
+
+template<class Callable_type, class Allocator_type>
+void delegate_base::storeCallable(Callable_type callable,
+                                  const Allocator_type &allocator)
+{
+    storeCallable(callable, allocator, stored_locally<Callable_type>());
+}
+
+template<class Callable_type, class Allocator_type>
+void delegate_base::storeCallable(Callable_type &callable,
+                                  const Allocator_type& /*allocator*/,
+                                  std::true_type)
+{
+    new(&m_storage) Callable_type(std::move(callable));
+    m_manager = &manageLocalCallable<Callable_type>;
+}
+
+template<class Callable_type, class Allocator_type>
+void delegate_base::storeCallable(Callable_type &callable,
+                                  const Allocator_type &allocator,
+                                  std::false_type)
+{
+    typedef heap_callable<Callable_type, Allocator_type> block_type;
+    typedef typename std::allocator_traits<Allocator_type>
+            ::template rebind_alloc<block_type> block_allocator;
+    typedef std::allocator_traits<block_allocator> block_traits;
+
+    block_allocator blockAllocator(allocator);
+    block_type* block = block_traits::allocate(blockAllocator, 1);
+
+    try {
+        new(block) block_type{std::move(callable), allocator};
+    }
+    catch(...)
+    {
+        block_traits::deallocate(blockAllocator, block, 1);
+        throw;
+    }
+
+    new(&m_storage) heap_target<Callable_type>{&block->m_callable, block};
+    m_manager = &manageHeapCallable<Callable_type, Allocator_type>;
+}
+
+template<class Target_type>
+Target_type& delegate_base::target(storage_type &storage)
+{
+    return *reinterpret_cast<Target_type*>(&storage);
+}
+
+template<class Callable_type>
+Callable_type& delegate_base::callableTarget(storage_type &storage)
+{
+    return callableTarget<Callable_type>(storage,
+                                         stored_locally<Callable_type>());
+}
+
+template<class Callable_type>
+Callable_type& delegate_base::callableTarget(storage_type &storage,
+                                             std::true_type)
+{
+    return target<Callable_type>(storage);
+}
+
+template<class Callable_type>
+Callable_type& delegate_base::callableTarget(storage_type &storage,
+                                             std::false_type)
+{
+    return *target<heap_target<Callable_type>>(storage).m_callable;
+}
+
+template<class Target_type>
+std::size_t delegate_base::hashTarget(const Target_type &target)
+{
+    return hashBytes(&target, sizeof(target));
+}
+
+template<class Object_type, class Function_type>
+std::size_t delegate_base::hashTarget(
+        const bound_member<Object_type, Function_type> &target)
+{
+    return target.hash();
+}
+
+template<class Target_type>
+bool delegate_base::manageTarget(operation op,
+                                 storage_type &target,
+                                 storage_type *other)
+{
+    switch(op)
+    {
+    case operation::destroy:
+        delegate_base::target<Target_type>(target).~Target_type();
+        return true;
+
+    case operation::move:
+        new(&target) Target_type(delegate_base::target<Target_type>(*other));
+        return true;
+
+    case operation::compare:
+        return (delegate_base::target<Target_type>(target) ==
+                delegate_base::target<Target_type>(*other));
+
+    case operation::hash:
+    {
+        std::size_t hash = hashTarget(delegate_base::target<Target_type>(target));
+
+        // 0 is reserved for targets which never compare equal
+        new(other) std::size_t(hash != 0 ? hash : 1);
+        return true;
+    }
+    }
+
+    return false;
+}
+
+template<class Callable_type>
+bool delegate_base::manageLocalCallable(operation op,
+                                        storage_type &target,
+                                        storage_type *other)
+{
+    switch(op)
+    {
+    case operation::destroy:
+        delegate_base::target<Callable_type>(target).~Callable_type();
+        return true;
+
+    case operation::move:
+        new(&target) Callable_type(
+                std::move(delegate_base::target<Callable_type>(*other)));
+        return true;
+
+    case operation::compare:
+    case operation::hash:
+        return false;
+    }
+
+    return false;
+}
+
+template<class Callable_type, class Allocator_type>
+bool delegate_base::manageHeapCallable(operation op,
+                                       storage_type &target,
+                                       storage_type *other)
+{
+    typedef heap_callable<Callable_type, Allocator_type> block_type;
+    typedef typename std::allocator_traits<Allocator_type>
+            ::template rebind_alloc<block_type> block_allocator;
+
+    switch(op)
+    {
+    case operation::destroy:
+    {
+        block_type* block = static_cast<block_type*>(
+                delegate_base::target<heap_target<Callable_type>>(target).m_block);
+
+        // The callable object was moved to another delegate
+        if(block == nullptr) return true;
+
+        block_allocator blockAllocator(block->m_allocator);
+
+        block->~block_type();
+        std::allocator_traits<block_allocator>::deallocate(blockAllocator, block, 1);
+        return true;
+    }
+
+    case operation::move:
+        new(&target) heap_target<Callable_type>(
+                delegate_base::target<heap_target<Callable_type>>(*other));
+        delegate_base::target<heap_target<Callable_type>>(*other).m_block = nullptr;
+        return true;
+
+    case operation::compare:
+    case operation::hash:
+        return false;
+    }
+
+    return false;
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_DELEGATE_BASE_H_INCLUDED
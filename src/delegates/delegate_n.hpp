@@ -0,0 +1,315 @@
+#pragma once
+#ifndef HYDROSIG_DELEGATE_N_HPP_INCLUDED
+#define HYDROSIG_DELEGATE_N_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "src/macros.h"
+#include "src/delegates/delegate_base/delegate_base.h"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class holds the target of a slot with the
+ *          given signature. Only function signatures are
+ *          supported, trough the specialization below.
+ */
+template<class Signature>
+class delegate_n;
+
+/**
+ * @brief   This class holds the target of a slot with any
+ *          number of arguments, which may be a free function,
+ *          a bound member function or a callable object.
+ * @details Calling the delegate takes a single indirect call
+ *          trough its invoker, which is selected upon
+ *          construction for the type of the target.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+class delegate_n<HYDROSIG_N_ARG> : public delegate_base
+{
+public:
+    /**< Typedef for the free function type */
+    typedef Return_type(*function_type)(Arg_types...);
+
+    /**
+     * @brief   Constructs a delegate_n from the given function
+     *          pointer.
+     * @param   function Pointer to the free function.
+     */
+    delegate_n(function_type function);
+
+    /**
+     * @brief   Constructs a delegate_n from pointer to the given
+     *          object and a member function pointer.
+     * @param   object Pointer to the target object.
+     * @param   function Pointer to the member function.
+     */
+    template<class Object_type>
+    delegate_n(Object_type* object,
+               Return_type(Object_type::*function)
+               (Arg_types...));
+
+    /**
+     * @brief   Constructs a delegate_n from pointer to the given
+     *          object and a const member function pointer.
+     * @param   object Pointer to the target object.
+     * @param   function Pointer to the member function.
+     */
+    template<class Object_type>
+    delegate_n(Object_type* object,
+               Return_type(Object_type::*function)
+               (Arg_types...) const);
+
+    /**
+     * @brief   Constructs a delegate_n from pointer to the given
+     *          object and a volatile member function pointer.
+     * @param   object Pointer to the target object.
+     * @param   function Pointer to the member function.
+     */
+    template<class Object_type>
+    delegate_n(Object_type* object,
+               Return_type(Object_type::*function)
+               (Arg_types...) volatile);
+
+    /**
+     * @brief   Constructs a delegate_n from pointer to the given
+     *          object and a const volatile member function pointer.
+     * @param   object Pointer to the target object.
+     * @param   function Pointer to the member function.
+     */
+    template<class Object_type>
+    delegate_n(Object_type* object,
+               Return_type(Object_type::*function)
+               (Arg_types...) const volatile);
+
+    /**
+     * @brief   Constructs a delegate_n from the copy of the
+     *          given callable object.
+     * @param   callable The callable object.
+     */
+    template<class Callable_type>
+    explicit delegate_n(Callable_type callable);
+
+    /**
+     * @brief   Constructs a delegate_n from the copy of the
+     *          given callable object.
+     * @details If the callable object is not stored inside
+     *          the delegate, it is allocated trough a copy
+     *          of the given allocator.
+     * @param   callable The callable object.
+     * @param   allocator The allocator to use.
+     */
+    template<class Callable_type, class Allocator_type>
+    delegate_n(Callable_type callable, const Allocator_type &allocator);
+
+    /**
+     * @brief   Constructs a delegate_n by moving the target of src.
+     * @param   src The delegate to move.
+     */
+    delegate_n(delegate_n&& src);
+
+    /**
+     * @brief   Calls the target of the delegate.
+     * @return  The result of the call.
+     * @param   args The arguments.
+     */
+    Return_type operator()(Arg_types&&... args);
+
+private:
+    /**< Typedef for the invoker of the target */
+    typedef Return_type(*invoker_type)(storage_type&, Arg_types&&...);
+
+    /**
+     * @brief   Stores the given object and member function
+     *          pointer as the target of the delegate.
+     */
+    template<class Object_type, class Function_type>
+    void bind(Object_type* object, Function_type function);
+
+    /**
+     * @brief   Invoker of free function targets.
+     */
+    static Return_type invokeFunction(storage_type &storage, Arg_types&&... args);
+
+    /**
+     * @brief   Invoker of bound member function targets.
+     */
+    template<class Object_type, class Function_type>
+    static Return_type invokeMember(storage_type &storage, Arg_types&&... args);
+
+    /**
+     * @brief   Invoker of callable object targets.
+     */
+    template<class Callable_type>
+    static Return_type invokeCallable(storage_type &storage, Arg_types&&... args);
+
+    /**< The invoker of the target */
+    invoker_type m_invoker;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+HYDROSIG_TEMPLATE_N_ARG
+delegate_n<HYDROSIG_N_ARG>::delegate_n(function_type function)
+    : m_invoker(&invokeFunction)
+{
+    if(function == nullptr)
+        throw std::invalid_argument("Nullptr provided as functor argument.");
+
+    store(function);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Object_type>
+delegate_n<HYDROSIG_N_ARG>::delegate_n(Object_type* object,
+                                       Return_type(Object_type::*function)
+                                       (Arg_types...))
+{
+    bind(object, function);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Object_type>
+delegate_n<HYDROSIG_N_ARG>::delegate_n(Object_type* object,
+                                       Return_type(Object_type::*function)
+                                       (Arg_types...) const)
+{
+    bind(object, function);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Object_type>
+delegate_n<HYDROSIG_N_ARG>::delegate_n(Object_type* object,
+                                       Return_type(Object_type::*function)
+                                       (Arg_types...) volatile)
+{
+    bind(object, function);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Object_type>
+delegate_n<HYDROSIG_N_ARG>::delegate_n(Object_type* object,
+                                       Return_type(Object_type::*function)
+                                       (Arg_types...) const volatile)
+{
+    bind(object, function);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Callable_type>
+delegate_n<HYDROSIG_N_ARG>::delegate_n(Callable_type callable)
+    : m_invoker(&invokeCallable<Callable_type>)
+{
+    storeCallable(std::move(callable), HYDROSIG_DEFAULT_ALLOCATOR());
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Callable_type, class Allocator_type>
+delegate_n<HYDROSIG_N_ARG>::delegate_n(Callable_type callable,
+                                       const Allocator_type &allocator)
+    : m_invoker(&invokeCallable<Callable_type>)
+{
+    storeCallable(std::move(callable), allocator);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+delegate_n<HYDROSIG_N_ARG>::delegate_n(delegate_n&& src)
+    : delegate_base(std::move(src)),
+      m_invoker(src.m_invoker)
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+Return_type delegate_n<HYDROSIG_N_ARG>::operator()(Arg_types&&... args)
+{
+    return m_invoker(m_storage,
+                     std::forward<Arg_types>(args)...);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Object_type, class Function_type>
+void delegate_n<HYDROSIG_N_ARG>::bind(Object_type* object,
+                                      Function_type function)
+{
+    if(function == nullptr || object == nullptr)
+        throw std::invalid_argument("Nullptr provided as functor argument.");
+
+    store(bound_member<Object_type, Function_type>{object, function});
+    m_invoker = &invokeMember<Object_type, Function_type>;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+Return_type delegate_n<HYDROSIG_N_ARG>::invokeFunction
+    (storage_type &storage, Arg_types&&... args)
+{
+    return target<function_type>(storage)(std::forward<Arg_types>(args)...);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Object_type, class Function_type>
+Return_type delegate_n<HYDROSIG_N_ARG>::invokeMember
+    (storage_type &storage, Arg_types&&... args)
+{
+    bound_member<Object_type, Function_type> &member =
+            target<bound_member<Object_type, Function_type>>(storage);
+
+    return (member.m_object->*member.m_function)(std::forward<Arg_types>(args)...);
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+template<class Callable_type>
+Return_type delegate_n<HYDROSIG_N_ARG>::invokeCallable
+    (storage_type &storage, Arg_types&&... args)
+{
+    Callable_type &callable = callableTarget<Callable_type>(storage);
+
+    return callable(std::forward<Arg_types>(args)...);
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_DELEGATE_N_HPP_INCLUDED
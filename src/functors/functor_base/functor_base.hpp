@@ -41,63 +41,39 @@ HYDROSIG_NAMESPACE_BEGIN
  */
 
 /**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with zero
- *          arguments. Note that this class is abstract.
+ * @brief   This class template provides a tag for each functor
+ *          type, which identifies the type without RTTI.
+ * @details The tag is the address of a static member, which is
+ *          distinct for each instantiation of the template.
  */
-HYDROSIG_TEMPLATE_0_ARG
-class functor_0_base
+template<class Functor_type>
+struct functor_tag
 {
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @return  The result of the function call.
-     */
-    virtual Return_type operator()() = 0;
+    /**< The object whose address is the tag */
+    static const char m_id;
 
     /**
-     * @brief   Destroys a functor_0_base object.
+     * @brief   Returns the tag of Functor_type.
+     * @return  The tag of the functor type.
      */
-    virtual ~functor_0_base();
-
+    static const void* value();
 };
 
 /**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with one
- *          arguments. Note that this class is abstract.
+ * @brief   This class template forms the base of functors
+ *          with the given signature. Only function signatures
+ *          are supported, trough the specialization below.
  */
-HYDROSIG_TEMPLATE_1_ARG
-class functor_1_base
-{
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @return  The result of the function call.
-     */
-    virtual Return_type operator()(Arg1_type) = 0;
-
-    /**
-     * @brief   Destroys a functor_1_base object.
-     */
-    virtual ~functor_1_base();
-
-};
+template<class Signature>
+class functor_n_base;
 
 /**
  * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with two
- *          arguments. Note that this class is abstract.
+ *          holding callable objects or functions with any
+ *          number of arguments. Note that this class is abstract.
  */
-HYDROSIG_TEMPLATE_2_ARG
-class functor_2_base
+HYDROSIG_TEMPLATE_N_ARG
+class functor_n_base<HYDROSIG_N_ARG>
 {
 public:
     /**
@@ -105,270 +81,139 @@ public:
      * @details Override this operator, according to the
      *          structure of your functor to support the
      *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
      * @return  The result of the function call.
      */
-    virtual Return_type operator()(Arg1_type, Arg2_type) = 0;
+    virtual Return_type operator()(Arg_types... args) = 0;
 
     /**
-     * @brief   Destroys a functor_2_base object.
-     */
-    virtual ~functor_2_base();
-
-};
-
-/**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with three
- *          arguments. Note that this class is abstract.
- */
-HYDROSIG_TEMPLATE_3_ARG
-class functor_3_base
-{
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
-     * @param   The type of the third argument.
-     * @return  The result of the function call.
+     * @brief   Constructs a functor_n_base object.
+     * @param   tag The tag of the functor type, see functor_tag.
+     *              Functors not comparable with comp_fun may leave
+     *              it nullptr.
      */
-    virtual Return_type operator()(Arg1_type, Arg2_type, Arg3_type) = 0;
+    functor_n_base(const void* tag = nullptr);
 
     /**
-     * @brief   Destroys a functor_3_base object.
+     * @brief   Destroys a functor_n_base object.
      */
-    virtual ~functor_3_base();
-
-};
+    virtual ~functor_n_base();
 
-/**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with four
- *          arguments. Note that this class is abstract.
- */
-HYDROSIG_TEMPLATE_4_ARG
-class functor_4_base
-{
-public:
     /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
-     * @param   The type of the third argument.
-     * @param   The type of the fourth argument.
-     * @return  The result of the function call.
+     * @brief   Returns the tag of the functor type.
+     * @details Functors with the same tag have the same type,
+     *          so the tag can be compared instead of casting.
+     * @return  The tag of the functor type.
      */
-    virtual Return_type operator()(Arg1_type, Arg2_type, Arg3_type,
-                                   Arg4_type) = 0;
+    const void* getTag() const;
 
-    /**
-     * @brief   Destroys a functor_4_base object.
-     */
-    virtual ~functor_4_base();
+private:
+    /**< The tag of the functor type */
+    const void* m_tag;
 
 };
 
-/**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with five
- *          arguments. Note that this class is abstract.
- */
-HYDROSIG_TEMPLATE_5_ARG
-class functor_5_base
-{
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
-     * @param   The type of the third argument.
-     * @param   The type of the fourth argument.
-     * @param   The type of the fifth argument.
-     * @return  The result of the function call.
-     */
-    virtual Return_type operator()(Arg1_type, Arg2_type, Arg3_type,
-                                   Arg4_type, Arg5_type) = 0;
 
-    /**
-     * @brief   Destroys a functor_5_base object.
-     */
-    virtual ~functor_5_base();
 
-};
 
 /**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with six
- *          arguments. Note that this class is abstract.
+ * Member definitions:
+ * -------------------
  */
-HYDROSIG_TEMPLATE_6_ARG
-class functor_6_base
-{
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
-     * @param   The type of the third argument.
-     * @param   The type of the fourth argument.
-     * @param   The type of the fifth argument.
-     * @param   The type of the sixth argument.
-     * @return  The result of the function call.
-     */
-    virtual Return_type operator()(Arg1_type, Arg2_type, Arg3_type,
-                                   Arg4_type, Arg5_type, Arg6_type) = 0;
 
-    /**
-     * @brief   Destroys a functor_6_base object.
-     */
-    virtual ~functor_6_base();
+template<class Functor_type>
+const char functor_tag<Functor_type>::m_id = 0;
 
-};
-
-/**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with sever
- *          arguments. Note that this class is abstract.
- */
-HYDROSIG_TEMPLATE_7_ARG
-class functor_7_base
+template<class Functor_type>
+const void* functor_tag<Functor_type>::value()
 {
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
-     * @param   The type of the third argument.
-     * @param   The type of the fourth argument.
-     * @param   The type of the fifth argument.
-     * @param   The type of the sixth argument.
-     * @param   The type of the seventh argument.
-     * @return  The result of the function call.
-     */
-    virtual Return_type operator()(Arg1_type, Arg2_type, Arg3_type,
-                                   Arg4_type, Arg5_type, Arg6_type,
-                                   Arg7_type) = 0;
-
-    /**
-     * @brief   Destroys a functor_7_base object.
-     */
-    virtual ~functor_7_base();
-
-};
+    return &m_id;
+}
 
-/**
- * @brief   This class template forms the base of functors,
- *          holding callable objects or functions with eight
- *          arguments. Note that this class is abstract.
- */
-HYDROSIG_TEMPLATE_8_ARG
-class functor_8_base
+HYDROSIG_TEMPLATE_N_ARG
+functor_n_base<HYDROSIG_N_ARG>::functor_n_base(const void* tag)
+    : m_tag(tag)
 {
-public:
-    /**
-     * @brief   Pure virtual function call operator.
-     * @details Override this operator, according to the
-     *          structure of your functor to support the
-     *          convenient functor interface.
-     * @param   The type of the first argument.
-     * @param   The type of the second argument.
-     * @param   The type of the third argument.
-     * @param   The type of the fourth argument.
-     * @param   The type of the fifth argument.
-     * @param   The type of the sixth argument.
-     * @param   The type of the seventh argument.
-     * @param   The type of the eight argument.
-     * @return  The result of the function call.
-     */
-    virtual Return_type operator()(Arg1_type, Arg2_type, Arg3_type,
-                                   Arg4_type, Arg5_type, Arg6_type,
-                                   Arg7_type, Arg8_type) = 0;
+    ;
+}
 
-    /**
-     * @brief   Destroys a functor_8_base object.
-     */
-    virtual ~functor_8_base();
+HYDROSIG_TEMPLATE_N_ARG
+functor_n_base<HYDROSIG_N_ARG>::~functor_n_base()
+{
+    ;
+}
 
-};
+HYDROSIG_TEMPLATE_N_ARG
+const void* functor_n_base<HYDROSIG_N_ARG>::getTag() const
+{
+    return m_tag;
+}
 
 
 
 
 /**
- * Member definitions:
- * -------------------
+ * Fixed arity aliases:
+ * --------------------
+ * Kept for code written against the per-arity functor templates.
  */
 
+/**
+ * @brief   Base of functors with no arguments.
+ */
 HYDROSIG_TEMPLATE_0_ARG
-functor_0_base<HYDROSIG_0_ARG>::~functor_0_base()
-{
-    ;
-}
+using functor_0_base = functor_n_base<Return_type()>;
 
+/**
+ * @brief   Base of functors with one argument.
+ */
 HYDROSIG_TEMPLATE_1_ARG
-functor_1_base<HYDROSIG_1_ARG>::~functor_1_base()
-{
-    ;
-}
+using functor_1_base = functor_n_base<Return_type(Arg1_type)>;
 
+/**
+ * @brief   Base of functors with two arguments.
+ */
 HYDROSIG_TEMPLATE_2_ARG
-functor_2_base<HYDROSIG_2_ARG>::~functor_2_base()
-{
-    ;
-}
+using functor_2_base = functor_n_base<Return_type(Arg1_type, Arg2_type)>;
 
+/**
+ * @brief   Base of functors with three arguments.
+ */
 HYDROSIG_TEMPLATE_3_ARG
-functor_3_base<HYDROSIG_3_ARG>::~functor_3_base()
-{
-    ;
-}
+using functor_3_base = functor_n_base<Return_type(Arg1_type, Arg2_type, Arg3_type)>;
 
+/**
+ * @brief   Base of functors with four arguments.
+ */
 HYDROSIG_TEMPLATE_4_ARG
-functor_4_base<HYDROSIG_4_ARG>::~functor_4_base()
-{
-    ;
-}
+using functor_4_base = functor_n_base<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
 
+/**
+ * @brief   Base of functors with five arguments.
+ */
 HYDROSIG_TEMPLATE_5_ARG
-functor_5_base<HYDROSIG_5_ARG>::~functor_5_base()
-{
-    ;
-}
+using functor_5_base = functor_n_base<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                  Arg5_type)>;
 
+/**
+ * @brief   Base of functors with six arguments.
+ */
 HYDROSIG_TEMPLATE_6_ARG
-functor_6_base<HYDROSIG_6_ARG>::~functor_6_base()
-{
-    ;
-}
+using functor_6_base = functor_n_base<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                  Arg5_type, Arg6_type)>;
 
+/**
+ * @brief   Base of functors with seven arguments.
+ */
 HYDROSIG_TEMPLATE_7_ARG
-functor_7_base<HYDROSIG_7_ARG>::~functor_7_base()
-{
-    ;
-}
+using functor_7_base = functor_n_base<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                  Arg5_type, Arg6_type, Arg7_type)>;
 
+/**
+ * @brief   Base of functors with eight arguments.
+ */
 HYDROSIG_TEMPLATE_8_ARG
-functor_8_base<HYDROSIG_8_ARG>::~functor_8_base()
-{
-    ;
-}
+using functor_8_base = functor_n_base<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                  Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
 
 
 HYDROSIG_NAMESPACE_END
@@ -0,0 +1,587 @@
+#pragma once
+#ifndef HYDROSIG_FUNCTOR_N_HPP_INCLUDED
+#define HYDROSIG_FUNCTOR_N_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <utility>
+
+#include "src/macros.h"
+#include "src/functors/functor_base/functor_base.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   These class templates encapsulate the targets of
+ *          functors with the given signature. Only function
+ *          signatures are supported, trough the specializations
+ *          below.
+ */
+template<class Signature>
+class functor_to_free_n;
+
+template<class Callable_type, class Signature>
+class functor_to_callable_n;
+
+template<class Object_type, class Function_type, class Signature>
+class functor_to_member_n;
+
+/**
+ * @brief   This class encapsulates a free function, such
+ *          as a global or static member method with any
+ *          number of arguments.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+class functor_to_free_n<HYDROSIG_N_ARG> : public functor_n_base<HYDROSIG_N_ARG>
+{
+public:
+    /**< Typedef for the function type */
+    typedef Return_type(*function_type)(Arg_types...);
+
+    /**
+     * @brief   Constructs a functor_to_free_n from the
+     *          given function pointer.
+     */
+    functor_to_free_n(function_type function);
+
+    /**
+     * @brief   Calls the encapsulated function.
+     * @return  The result of the function call.
+     * @param   args The arguments of the call.
+     */
+    Return_type operator()(Arg_types... args);
+
+    /**
+     * @brief   Compares this functor with another for equality.
+     * @details Two functors compare equal, if they refer to the
+     *          same free function.
+     * @param   other The other functor.
+     * @return  True if the functors compare equal.
+     */
+    bool operator==(const functor_to_free_n &other);
+
+private:
+    /**< Pointer to the encapsulated function */
+    function_type m_function;
+
+};
+
+/**
+ * @brief   This class encapsulates a callable object, such
+ *          as a lambda-expression, expecting any number of
+ *          arguments.
+ */
+template<class Callable_type, class Return_type, class... Arg_types>
+class functor_to_callable_n<Callable_type, HYDROSIG_N_ARG>
+        : public functor_n_base<HYDROSIG_N_ARG>
+{
+public:
+    /**
+     * @brief   Constructs a functor_to_callable_n from the
+     *          copy of the given callable object.
+     */
+    functor_to_callable_n(Callable_type callable);
+
+    /**
+     * @brief   Calls the encapsulated function.
+     * @return  The result of the function call.
+     * @param   args The arguments of the call.
+     */
+    Return_type operator()(Arg_types... args);
+
+private:
+    /**< The callable object */
+    Callable_type m_callable;
+
+};
+
+/**
+ * @brief   This class encapsulates a bound member function
+ *          with any number of arguments.
+ * @details Function_type is the type of the member function
+ *          pointer, so the same template serves the const,
+ *          volatile and const volatile member functions.
+ */
+template<class Object_type, class Function_type, class Return_type, class... Arg_types>
+class functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG>
+        : public functor_n_base<HYDROSIG_N_ARG>
+{
+public:
+    /**< Typedef for the function type */
+    typedef Function_type function_type;
+
+    /**
+     * @brief   Constructs a functor_to_member_n from pointer to
+     *          the given object and a member function pointer.
+     */
+    functor_to_member_n(Object_type* object,
+                        function_type function);
+
+    /**
+     * @brief   Calls the encapsulated function on the object.
+     * @return  The result of the function call.
+     * @param   args The arguments of the call.
+     */
+    Return_type operator()(Arg_types... args);
+
+    /**
+     * @brief   Compares this functor with another for equality.
+     * @details Two functors compare equal, if they refer to the
+     *          same member function of the same object.
+     * @param   other The other functor.
+     * @return  True if the functors compare equal.
+     */
+    bool operator==(const functor_to_member_n &other);
+
+private:
+    /**< Pointer to the target object */
+    Object_type*  m_object;
+
+    /**< Pointer to the encapsulated function */
+    function_type m_function;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+HYDROSIG_TEMPLATE_N_ARG
+functor_to_free_n<HYDROSIG_N_ARG>::functor_to_free_n(
+        function_type function)
+        : functor_n_base<HYDROSIG_N_ARG>(functor_tag<functor_to_free_n>::value()),
+          m_function(function)
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+Return_type functor_to_free_n<HYDROSIG_N_ARG>::operator()
+    (Arg_types... args)
+{
+    try {
+        return m_function(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+bool functor_to_free_n<HYDROSIG_N_ARG>::operator==(
+        const functor_to_free_n &other)
+{
+    if(m_function == other.m_function)
+        return true;
+
+    return false;
+}
+
+template<class Callable_type, class Return_type, class... Arg_types>
+functor_to_callable_n<Callable_type, HYDROSIG_N_ARG>::functor_to_callable_n(
+        Callable_type callable)
+    : functor_n_base<HYDROSIG_N_ARG>(functor_tag<functor_to_callable_n>::value()),
+      m_callable(callable)
+{
+    ;
+}
+
+template<class Callable_type, class Return_type, class... Arg_types>
+Return_type functor_to_callable_n<Callable_type, HYDROSIG_N_ARG>::operator()
+    (Arg_types... args)
+{
+    try {
+        return m_callable(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+template<class Object_type, class Function_type, class Return_type, class... Arg_types>
+functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG>::functor_to_member_n(
+        Object_type* object,
+        function_type function)
+    : functor_n_base<HYDROSIG_N_ARG>(functor_tag<functor_to_member_n>::value()),
+      m_object(object),
+      m_function(function)
+{
+    ;
+}
+
+template<class Object_type, class Function_type, class Return_type, class... Arg_types>
+Return_type functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG>::operator()
+    (Arg_types... args)
+{
+    try {
+        return (m_object->*m_function)(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+template<class Object_type, class Function_type, class Return_type, class... Arg_types>
+bool functor_to_member_n<Object_type, Function_type, HYDROSIG_N_ARG>::operator==(
+        const functor_to_member_n &other)
+{
+    if(m_object == other.m_object
+            &&
+       m_function == other.m_function)
+        return true;
+
+    return false;
+}
+
+
+
+
+/**
+ * Fixed arity aliases:
+ * --------------------
+ * Kept for code written against the per-arity functor templates.
+ */
+
+/**
+ * @brief   Functors with no arguments.
+ */
+HYDROSIG_TEMPLATE_0_ARG
+using functor_to_free_0 = functor_to_free_n<Return_type()>;
+
+HYDROSIG_TEMPLATE_CALLABLE_0_ARG
+using functor_to_callable_0 = functor_to_callable_n<Callable_type, Return_type()>;
+
+HYDROSIG_TEMPLATE_OBJECT_0_ARG
+using functor_to_member_0 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(),
+                                                Return_type()>;
+
+HYDROSIG_TEMPLATE_OBJECT_0_ARG
+using functor_to_member_const_0 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)() const,
+                                                      Return_type()>;
+
+HYDROSIG_TEMPLATE_OBJECT_0_ARG
+using functor_to_member_volatile_0 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)() volatile,
+                                                         Return_type()>;
+
+HYDROSIG_TEMPLATE_OBJECT_0_ARG
+using functor_to_member_const_volatile_0 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)() const volatile,
+                                                               Return_type()>;
+
+/**
+ * @brief   Functors with one argument.
+ */
+HYDROSIG_TEMPLATE_1_ARG
+using functor_to_free_1 = functor_to_free_n<Return_type(Arg1_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_1_ARG
+using functor_to_callable_1 = functor_to_callable_n<Callable_type, Return_type(Arg1_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_1_ARG
+using functor_to_member_1 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type),
+                                                Return_type(Arg1_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_1_ARG
+using functor_to_member_const_1 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type) const,
+                                                      Return_type(Arg1_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_1_ARG
+using functor_to_member_volatile_1 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type) volatile,
+                                                         Return_type(Arg1_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_1_ARG
+using functor_to_member_const_volatile_1 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type) const volatile,
+                                                               Return_type(Arg1_type)>;
+
+/**
+ * @brief   Functors with two arguments.
+ */
+HYDROSIG_TEMPLATE_2_ARG
+using functor_to_free_2 = functor_to_free_n<Return_type(Arg1_type, Arg2_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_2_ARG
+using functor_to_callable_2 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_2_ARG
+using functor_to_member_2 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type),
+                                                Return_type(Arg1_type, Arg2_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_2_ARG
+using functor_to_member_const_2 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type) const,
+                                                      Return_type(Arg1_type, Arg2_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_2_ARG
+using functor_to_member_volatile_2 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_2_ARG
+using functor_to_member_const_volatile_2 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type)>;
+
+/**
+ * @brief   Functors with three arguments.
+ */
+HYDROSIG_TEMPLATE_3_ARG
+using functor_to_free_3 = functor_to_free_n<Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_3_ARG
+using functor_to_callable_3 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_3_ARG
+using functor_to_member_3 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type),
+                                                Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_3_ARG
+using functor_to_member_const_3 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type) const,
+                                                      Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_3_ARG
+using functor_to_member_volatile_3 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_3_ARG
+using functor_to_member_const_volatile_3 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type, Arg3_type)>;
+
+/**
+ * @brief   Functors with four arguments.
+ */
+HYDROSIG_TEMPLATE_4_ARG
+using functor_to_free_4 = functor_to_free_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_4_ARG
+using functor_to_callable_4 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_4_ARG
+using functor_to_member_4 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type),
+                                                Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_4_ARG
+using functor_to_member_const_4 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type) const,
+                                                      Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_4_ARG
+using functor_to_member_volatile_4 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_4_ARG
+using functor_to_member_const_volatile_4 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type)>;
+
+/**
+ * @brief   Functors with five arguments.
+ */
+HYDROSIG_TEMPLATE_5_ARG
+using functor_to_free_5 = functor_to_free_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                        Arg5_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_5_ARG
+using functor_to_callable_5 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                               Arg5_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_5_ARG
+using functor_to_member_5 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                            Arg5_type),
+                                                Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_5_ARG
+using functor_to_member_const_5 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                  Arg5_type) const,
+                                                      Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                  Arg5_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_5_ARG
+using functor_to_member_volatile_5 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                     Arg5_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                     Arg5_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_5_ARG
+using functor_to_member_const_volatile_5 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                           Arg5_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                           Arg5_type)>;
+
+/**
+ * @brief   Functors with six arguments.
+ */
+HYDROSIG_TEMPLATE_6_ARG
+using functor_to_free_6 = functor_to_free_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                        Arg5_type, Arg6_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_6_ARG
+using functor_to_callable_6 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                               Arg5_type, Arg6_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_6_ARG
+using functor_to_member_6 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                            Arg5_type, Arg6_type),
+                                                Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type, Arg6_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_6_ARG
+using functor_to_member_const_6 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                  Arg5_type, Arg6_type) const,
+                                                      Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                  Arg5_type, Arg6_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_6_ARG
+using functor_to_member_volatile_6 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                     Arg5_type, Arg6_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                     Arg5_type, Arg6_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_6_ARG
+using functor_to_member_const_volatile_6 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                           Arg5_type, Arg6_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                           Arg5_type, Arg6_type)>;
+
+/**
+ * @brief   Functors with seven arguments.
+ */
+HYDROSIG_TEMPLATE_7_ARG
+using functor_to_free_7 = functor_to_free_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                        Arg5_type, Arg6_type, Arg7_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_7_ARG
+using functor_to_callable_7 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                               Arg5_type, Arg6_type, Arg7_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_7_ARG
+using functor_to_member_7 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                            Arg5_type, Arg6_type, Arg7_type),
+                                                Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type, Arg6_type, Arg7_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_7_ARG
+using functor_to_member_const_7 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                  Arg5_type, Arg6_type, Arg7_type) const,
+                                                      Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                  Arg5_type, Arg6_type, Arg7_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_7_ARG
+using functor_to_member_volatile_7 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                     Arg5_type, Arg6_type, Arg7_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                     Arg5_type, Arg6_type, Arg7_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_7_ARG
+using functor_to_member_const_volatile_7 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                           Arg5_type, Arg6_type, Arg7_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                           Arg5_type, Arg6_type, Arg7_type)>;
+
+/**
+ * @brief   Functors with eight arguments.
+ */
+HYDROSIG_TEMPLATE_8_ARG
+using functor_to_free_8 = functor_to_free_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                        Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+HYDROSIG_TEMPLATE_CALLABLE_8_ARG
+using functor_to_callable_8 = functor_to_callable_n<Callable_type, Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                               Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_8_ARG
+using functor_to_member_8 = functor_to_member_n<Object_type,
+                                                Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                            Arg5_type, Arg6_type, Arg7_type, Arg8_type),
+                                                Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                            Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_8_ARG
+using functor_to_member_const_8 = functor_to_member_n<Object_type,
+                                                      Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                  Arg5_type, Arg6_type, Arg7_type, Arg8_type) const,
+                                                      Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                  Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_8_ARG
+using functor_to_member_volatile_8 = functor_to_member_n<Object_type,
+                                                         Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                     Arg5_type, Arg6_type, Arg7_type, Arg8_type) volatile,
+                                                         Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                     Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+HYDROSIG_TEMPLATE_OBJECT_8_ARG
+using functor_to_member_const_volatile_8 = functor_to_member_n<Object_type,
+                                                               Return_type(Object_type::*)(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                                           Arg5_type, Arg6_type, Arg7_type, Arg8_type) const volatile,
+                                                               Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                                                           Arg5_type, Arg6_type, Arg7_type, Arg8_type)>;
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_FUNCTOR_N_HPP_INCLUDED
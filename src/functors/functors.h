@@ -29,15 +29,6 @@
 
 #include "src/functors/functor_base/functor_base.hpp"
 
-#include "src/functors/functor_0.hpp"
-#include "src/functors/functor_1.hpp"
-#include "src/functors/functor_2.hpp"
-#include "src/functors/functor_3.hpp"
-#include "src/functors/functor_4.hpp"
-#include "src/functors/functor_5.hpp"
-#include "src/functors/functor_6.hpp"
-#include "src/functors/functor_7.hpp"
-#include "src/functors/functor_8.hpp"
-
+#include "src/functors/functor_n.hpp"
 
 #endif // HYDROSIG_FUNCTORS_H_INCLUDED
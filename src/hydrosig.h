@@ -30,11 +30,13 @@
 #include "src/config.h"
 #include "src/macros.h"
 #include "src/connections/connections.h"
+#include "src/delegates/delegates.h"
 #include "src/functors/functors.h"
 #include "src/comp_funs/comp_funs.h"
 #include "src/make_funs/make_funs.h"
 #include "src/signals/signals.h"
 #include "src/slots/slots.h"
+#include "src/threading/threading_policies.h"
 #include "src/trackable/trackable.h"
 
 
@@ -57,56 +57,84 @@
 
 
 
+/**
+ * Language standard macros:
+ * -------------------------
+ */
+
+/*******************************************************
+ * Defined if the translation unit is compiled as C++14
+ * or later. The shared mutex threading policy needs
+ * C++14, and is left out otherwise.
+ ******************************************************/
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+# define HYDROSIG_CPP14_AVAILABLE
+#endif
+
+/*******************************************************
+ * Defined if the translation unit is compiled as C++17
+ * or later. The static signals and slots need C++17,
+ * and are left out otherwise. MSVC only reports the
+ * standard in _MSVC_LANG, unless /Zc:__cplusplus is set.
+ ******************************************************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+# define HYDROSIG_CPP17_AVAILABLE
+#endif
+
+
+
+
 /**
  * Multithreading synchrosisation macros:
  * --------------------------------------
  */
 
 /****************************************************************
- * Defines the beginning of a data-race protected code block.
+ * Defines the beginning of a data-race protected code block in
+ * signals, synchronised according to their threading policy.
+ * The thread running a transaction on the signal already holds
+ * its mutex, and does not lock it again.
  ***************************************************************/
-#ifdef HYDROSIG_SYNCHRONISE_THREADS
-# define HYDROSIG_PROTECTED_BLOCK_BEGIN \
-         HYDROSIG_LOCK_GUARD_TYPE guard(this->m_mutex);
-#else
-# define HYDROSIG_PROTECTED_BLOCK_BEGIN \
-         ;
-#endif
+#define HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN \
+        typename Threading_policy::lock_type guard(this->m_mutex, std::defer_lock); \
+        if(!this->ownsTransaction()) guard.lock();
 
 /****************************************************************
- * Defines the end of a data-race protected code block.
+ * Defines the end of a data-race protected code block in
+ * signals.
  ***************************************************************/
-#ifdef HYDROSIG_SYNCHRONISE_THREADS
-# define HYDROSIG_PROTECTED_BLOCK_END \
-         guard.unlock();
-#else
-# define HYDROSIG_PROTECTED_BLOCK_END \
-         ;
-#endif
+#define HYDROSIG_SIGNAL_PROTECTED_BLOCK_END \
+        if(guard.owns_lock()) guard.unlock();
 
 /****************************************************************
- * Defines the beginning of a data-race protected code block,
- * using a remote object of the same class.
+ * Defines the beginning of a data-race protected code block in
+ * signals, using a remote signal of the same class.
  ***************************************************************/
-#ifdef HYDROSIG_SYNCHRONISE_THREADS
-# define HYDROSIG_REMOTE_PROTECTED_BLOCK_BEGIN \
-         HYDROSIG_LOCK_GUARD_TYPE remoteGuard(src.m_mutex);
-#else
-# define HYDROSIG_REMOTE_PROTECTED_BLOCK_BEGIN \
-         ;
-#endif
+#define HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN \
+        typename Threading_policy::lock_type remoteGuard(src.m_mutex);
 
 /****************************************************************
- * Defines the end of a data-race protected code block,
- * using a remote object of the same class.
+ * Defines the end of a data-race protected code block in
+ * signals, using a remote signal of the same class.
  ***************************************************************/
-#ifdef HYDROSIG_SYNCHRONISE_THREADS
-# define HYDROSIG_REMOTE_PROTECTED_BLOCK_END \
-         remoteGuard.unlock();
-#else
-# define HYDROSIG_REMOTE_PROTECTED_BLOCK_END \
-         ;
-#endif
+#define HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END \
+        remoteGuard.unlock();
+
+/****************************************************************
+ * Defines the beginning of a code block in signals which only
+ * reads the list of slots, and may run concurrently with other
+ * such blocks if the threading policy allows it. Like protected
+ * blocks, it does not lock within a transaction of its thread.
+ ***************************************************************/
+#define HYDROSIG_SIGNAL_SHARED_BLOCK_BEGIN \
+        typename Threading_policy::shared_lock_type sharedGuard(this->m_mutex, std::defer_lock); \
+        if(!this->ownsTransaction()) sharedGuard.lock();
+
+/****************************************************************
+ * Defines the end of a shared code block in signals.
+ ***************************************************************/
+#define HYDROSIG_SIGNAL_SHARED_BLOCK_END \
+        if(sharedGuard.owns_lock()) sharedGuard.unlock();
 
 
 
@@ -194,6 +222,33 @@ template<class Return_type,                                 \
          class Arg4_type, class Arg5_type, class Arg6_type, \
          class Arg7_type, class Arg8_type>                  \
 
+/************************************************************
+ * Template declaration for any number of arguments.
+ ***********************************************************/
+#define HYDROSIG_TEMPLATE_N_ARG                             \
+                                                            \
+template<class Return_type,                                 \
+         class... Arg_types>                                \
+
+
+
+
+/**
+ * Template declaration macros for signals:
+ * ----------------------------------------
+ */
+
+/********************************************************************
+ * Template declaration for any number of arguments, with threading
+ * policy and allocator.
+ *******************************************************************/
+#define HYDROSIG_SIGNAL_TEMPLATE_N_ARG                          \
+                                                                \
+template<class Return_type,                                     \
+         class Threading_policy,                                \
+         class Allocator_type,                                  \
+         class... Arg_types>                                    \
+
 
 
 
@@ -452,6 +507,27 @@ template<class Callable_type,                                   \
                             Arg4_type, Arg5_type, Arg6_type,    \
                             Arg7_type, Arg8_type                \
 
+/****************************************************************
+ * Parameter list for any number of arguments, as a signature.
+ ***************************************************************/
+#define HYDROSIG_N_ARG      Return_type(Arg_types...)           \
+
+
+
+
+/**
+ * Template parameter list macros for signals:
+ * -------------------------------------------
+ */
+
+/************************************************************************
+ * Parameter list for any number of arguments, with threading policy
+ * and allocator.
+ ***********************************************************************/
+#define HYDROSIG_SIGNAL_N_ARG       Return_type(Arg_types...),          \
+                                    Threading_policy,                   \
+                                    Allocator_type                      \
+
 
 
 
@@ -627,78 +703,6 @@ template<class Return_type,
 
 
 
-/**
- * Template parameter list macro for portable syntax wrappers:
- * -----------------------------------------------------------
- */
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for zero arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_0_ARG     Return_type,                        \
-                                            no_arg, no_arg, no_arg,             \
-                                            no_arg, no_arg, no_arg,             \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for one arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_1_ARG     Return_type,                        \
-                                            Arg1_type, no_arg, no_arg,          \
-                                            no_arg, no_arg, no_arg,             \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for two arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_2_ARG     Return_type,                        \
-                                            Arg1_type, Arg2_type, no_arg,       \
-                                            no_arg, no_arg, no_arg,             \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for three arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_3_ARG     Return_type,                        \
-                                            Arg1_type, Arg2_type, Arg3_type,    \
-                                            no_arg, no_arg, no_arg,             \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for four arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_4_ARG     Return_type,                        \
-                                            Arg1_type, Arg2_type, Arg3_type,    \
-                                            Arg4_type, no_arg, no_arg,          \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for five arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_5_ARG     Return_type,                        \
-                                            Arg1_type, Arg2_type, Arg3_type,    \
-                                            Arg4_type, Arg5_type, no_arg,       \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for six arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_6_ARG     Return_type,                        \
-                                            Arg1_type, Arg2_type, Arg3_type,    \
-                                            Arg4_type, Arg5_type, Arg6_type,    \
-                                            no_arg, no_arg                      \
-
-/********************************************************************************
- * Parameter list for portable syntax wrapper for seven arguments.
- *******************************************************************************/
-#define HYDROSIG_PORTABLE_WRAPPER_7_ARG     Return_type,                        \
-                                            Arg1_type, Arg2_type, Arg3_type,    \
-                                            Arg4_type, Arg5_type, Arg6_type,    \
-                                            Arg7_type, no_arg                   \
-
-
-
-
 /**
  * SFINAE enablers for connecting and disconnecting functions:
  * -----------------------------------------------------------
@@ -743,244 +747,24 @@ typename std::enable_if<std::is_base_of<trackable,Object_type>
          ::value, void>::type                                                       \
 
 /************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 0 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_0                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_0_base<HYDROSIG_0_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 0 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_0                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_0_base<HYDROSIG_0_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 1 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_1                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_1_base<HYDROSIG_1_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 1 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_1                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_1_base<HYDROSIG_1_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 2 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_2                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_2_base<HYDROSIG_2_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 2 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_2                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_2_base<HYDROSIG_2_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 3 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_3                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_3_base<HYDROSIG_3_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 3 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_3                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_3_base<HYDROSIG_3_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 4 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_4                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_4_base<HYDROSIG_4_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 4 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_4                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_4_base<HYDROSIG_4_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 5 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_5                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_5_base<HYDROSIG_5_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 5 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_5                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_5_base<HYDROSIG_5_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 6 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_6                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_6_base<HYDROSIG_6_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 6 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_6                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_6_base<HYDROSIG_6_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 7 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_7                                 \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_7_base<HYDROSIG_7_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 7 arguments.
- ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_7                                   \
-                                                                                    \
-template<class Object_type>                                                         \
-typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_7_base<HYDROSIG_7_ARG>::connection_type>::type    \
-
-/************************************************************************************
- * SFINAE enabler for connecter functions for untrackable objects, with 8 arguments.
+ * SFINAE enabler for connecter functions for untrackable objects, outside of the
+ * class declaration.
  ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_8                                 \
+#define HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_N                                 \
                                                                                     \
 template<class Object_type>                                                         \
 typename std::enable_if<!std::is_base_of<trackable,Object_type>                     \
-         ::value, typename signal_8_base<HYDROSIG_8_ARG>::connection_type>::type    \
+         ::value, typename signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connection_type>::type    \
 
 /************************************************************************************
- * SFINAE enabler for connecter functions for trackable objects, with 8 arguments.
+ * SFINAE enabler for connecter functions for trackable objects, outside of the
+ * class declaration.
  ***********************************************************************************/
-#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_8                                   \
+#define HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_N                                   \
                                                                                     \
 template<class Object_type>                                                         \
 typename std::enable_if<std::is_base_of<trackable,Object_type>                      \
-         ::value, typename signal_8_base<HYDROSIG_8_ARG>::connection_type>::type    \
-
-
-
-
-/**
- * Template parameter list macro for elegant syntax wrappers:
- * ----------------------------------------------------------
- */
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for zero arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_0_ARG                              \
-                                                                    \
-Return_type()                                                       \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for one arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_1_ARG                              \
-                                                                    \
-Return_type(Arg1_type)                                              \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for two arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_2_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type)                                   \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for three arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_3_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type, Arg3_type)                        \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for four arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_4_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type, Arg3_type,                        \
-            Arg4_type)                                              \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for five arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_5_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type, Arg3_type,                        \
-            Arg4_type, Arg5_type)                                   \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for six arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_6_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type, Arg3_type,                        \
-            Arg4_type, Arg5_type, Arg6_type)                        \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for seven arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_7_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type, Arg3_type,                        \
-            Arg4_type, Arg5_type, Arg6_type,                        \
-            Arg7_type)                                              \
-
-/********************************************************************
- * Parameter list for elegant syntax wrapper for eight arguments.
- *******************************************************************/
-#define HYDROSIG_ELEGANT_WRAPPER_8_ARG                              \
-                                                                    \
-Return_type(Arg1_type, Arg2_type, Arg3_type,                        \
-            Arg4_type, Arg5_type, Arg6_type,                        \
-            Arg7_type, Arg8_type)                                   \
+         ::value, typename signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connection_type>::type    \
 
 
 
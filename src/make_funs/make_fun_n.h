@@ -1,6 +1,6 @@
 #pragma once
-#ifndef HYDROSIG_MAKE_FUN_4_H_INCLUDED
-#define HYDROSIG_MAKE_FUN_4_H_INCLUDED
+#ifndef HYDROSIG_MAKE_FUN_N_H_INCLUDED
+#define HYDROSIG_MAKE_FUN_N_H_INCLUDED
 
 /*
  * MIT License
@@ -30,7 +30,7 @@
 #include <stdexcept>
 
 #include "src/macros.h"
-#include "src/functors/functor_4.hpp"
+#include "src/functors/functor_n.hpp"
 
 
 HYDROSIG_NAMESPACE_BEGIN
@@ -43,89 +43,86 @@ HYDROSIG_NAMESPACE_BEGIN
 
 /**
  * @brief   Creates a functor from the given free function
- *          with four arguments.
+ *          with any number of arguments.
  * @details Note that returned functor must be deleted
  *          manually.
  * @param   function Pointer to the free function.
  * @return  A pointer to the created functor.
  */
-HYDROSIG_TEMPLATE_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Return_type(*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type));
+HYDROSIG_TEMPLATE_N_ARG
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Return_type(*function)
+                                         (Arg_types...));
 
 /**
  * @brief   Creates a functor from the given callable
-            object expecting four arguments.
+ *          object expecting any number of arguments.
  * @details Note that returned functor must be deleted
- *          manually.
+ *          manually. The return and argument types can not
+ *          be deduced, they must be specified explicitly
+ *          after the type of the callable object.
  * @param   callable The callable object.
  * @return  A pointer to the created functor.
  */
-HYDROSIG_TEMPLATE_CALLABLE_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Callable_type callable);
+template<class Callable_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Callable_type callable);
 
 /**
  * @brief   Creates a functor from the given object
- *          and member function with four arguments.
+ *          and member function with any number of arguments.
  * @details Note that returned functor must be deleted
  *          manually.
  * @param   object The object to perform the member function on.
  * @param   function Pointer to the member function.
  * @return  A pointer to the created functor.
  */
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type));
+                                         (Arg_types...));
 
 /**
  * @brief   Creates a functor from the given object
- *          and const member function with four arguments.
+ *          and const member function with any number of arguments.
  * @details Note that returned functor must be deleted
  *          manually.
  * @param   object The object to perform the member function on.
  * @param   function Pointer to the member function.
  * @return  A pointer to the created functor.
  */
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type)
+                                         (Arg_types...)
                                          const);
 
 /**
  * @brief   Creates a functor from the given object
- *          and volatile member function with four arguments.
+ *          and volatile member function with any number of arguments.
  * @details Note that returned functor must be deleted
  *          manually.
  * @param   object The object to perform the member function on.
  * @param   function Pointer to the member function.
  * @return  A pointer to the created functor.
  */
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type)
+                                         (Arg_types...)
                                          volatile);
 
 /**
  * @brief   Creates a functor from the given object
- *          and const volatile member function with four arguments.
+ *          and const volatile member function with any number of arguments.
  * @details Note that returned functor must be deleted
  *          manually.
  * @param   object The object to perform the member function on.
  * @param   function Pointer to the member function.
  * @return  A pointer to the created functor.
  */
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type)
+                                         (Arg_types...)
                                          const volatile);
 
 
@@ -136,16 +133,15 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
  * ---------------------
  */
 
-HYDROSIG_TEMPLATE_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Return_type(*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type))
+HYDROSIG_TEMPLATE_N_ARG
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Return_type(*function)
+                                         (Arg_types...))
 {
     if(function == nullptr)
         throw std::invalid_argument("Nullptr provided as functor argument.");
 
     try {
-        return new functor_to_free_4<HYDROSIG_4_ARG>
+        return new functor_to_free_n<HYDROSIG_N_ARG>
                    (function);
     }
     catch(...)
@@ -154,11 +150,11 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Return_type(*function)
     }
 }
 
-HYDROSIG_TEMPLATE_CALLABLE_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Callable_type callable)
+template<class Callable_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Callable_type callable)
 {
     try {
-        return new functor_to_callable_4<HYDROSIG_CALLABLE_4_ARG>
+        return new functor_to_callable_n<Callable_type, HYDROSIG_N_ARG>
                    (callable);
     }
     catch(...)
@@ -167,17 +163,18 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Callable_type callable)
     }
 }
 
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type))
+                                         (Arg_types...))
 {
     if(function == nullptr || object == nullptr)
         throw std::invalid_argument("Nullptr provided as functor argument.");
 
     try {
-        return new functor_to_member_4<HYDROSIG_OBJECT_4_ARG>
+        return new functor_to_member_n<Object_type,
+                                       Return_type(Object_type::*)(Arg_types...),
+                                       HYDROSIG_N_ARG>
                    (object, function);
     }
     catch(...)
@@ -186,18 +183,19 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
     }
 }
 
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type)
+                                         (Arg_types...)
                                          const)
 {
     if(function == nullptr || object == nullptr)
         throw std::invalid_argument("Nullptr provided as functor argument.");
 
     try {
-        return new functor_to_member_const_4<HYDROSIG_OBJECT_4_ARG>
+        return new functor_to_member_n<Object_type,
+                                       Return_type(Object_type::*)(Arg_types...) const,
+                                       HYDROSIG_N_ARG>
                    (object, function);
     }
     catch(...)
@@ -206,18 +204,19 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
     }
 }
 
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type)
+                                         (Arg_types...)
                                          volatile)
 {
     if(function == nullptr || object == nullptr)
         throw std::invalid_argument("Nullptr provided as functor argument.");
 
     try {
-        return new functor_to_member_volatile_4<HYDROSIG_OBJECT_4_ARG>
+        return new functor_to_member_n<Object_type,
+                                       Return_type(Object_type::*)(Arg_types...) volatile,
+                                       HYDROSIG_N_ARG>
                    (object, function);
     }
     catch(...)
@@ -226,18 +225,19 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
     }
 }
 
-HYDROSIG_TEMPLATE_OBJECT_4_ARG
-functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
+template<class Object_type, class Return_type, class... Arg_types>
+functor_n_base<HYDROSIG_N_ARG>* make_fun(Object_type* object,
                                          Return_type(Object_type::*function)
-                                         (Arg1_type, Arg2_type, Arg3_type,
-                                          Arg4_type)
+                                         (Arg_types...)
                                          const volatile)
 {
     if(function == nullptr || object == nullptr)
         throw std::invalid_argument("Nullptr provided as functor argument.");
 
     try {
-        return new functor_to_member_const_volatile_4<HYDROSIG_OBJECT_4_ARG>
+        return new functor_to_member_n<Object_type,
+                                       Return_type(Object_type::*)(Arg_types...) const volatile,
+                                       HYDROSIG_N_ARG>
                    (object, function);
     }
     catch(...)
@@ -250,4 +250,4 @@ functor_4_base<HYDROSIG_4_ARG>* make_fun(Object_type* object,
 HYDROSIG_NAMESPACE_END
 
 
-#endif // HYDROSIG_MAKE_FUN_4_H_INCLUDED
+#endif // HYDROSIG_MAKE_FUN_N_H_INCLUDED
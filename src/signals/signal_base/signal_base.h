@@ -31,18 +31,33 @@
 
 #ifdef HYDROSIG_HYDROGEN_AVAILABLE
 # include ../HContainers/HList/HList.hpp
-# include ../HConcurrent/HMutex.h
 #else
+# include <atomic>
 # include <list>
-# include <mutex>
+# include <memory>
 #endif
 
+#include <type_traits>
+
 #include "src/trackable/trackable.h"
+#include "src/slots/slot_base/slot_base.h"
+#include "src/threading/threading_policies.h"
 
 
 HYDROSIG_NAMESPACE_BEGIN
 
 
+/**
+ * Forward declarations:
+ * ---------------------
+ */
+
+template<class Signature, class... Slot_types>
+class static_signal;
+
+
+
+
 /**
  * Class declarations:
  * -------------------
@@ -60,15 +75,26 @@ HYDROSIG_NAMESPACE_BEGIN
  *          type-dependent, so pure virtual methods are provided
  *          to be overriden. Clearing a signal, and it's response
  *          when it receives a destruction notification is also
- *          implemented in the derived signal classes.
+ *          implemented in the derived signal classes, along with
+ *          the synchronisation selected by their threading policy.
  */
 class signal_base
 {
+    /**< Friend declaration for static_signals */
+    template<class Signature, class... Slot_types>
+    friend class static_signal;
+
 public:
     /**
      * @brief   Constructs a signal in a non-blocked state.
+     * @param   lockFreeEmission Whether the signal is emitted
+     *                           without locking, in which case
+     *                           the invalidation counter is
+     *                           created upfront.
+     * @param   allocator The allocator of the invalidation counter.
      */
-    signal_base();
+    template<class Allocator_type>
+    signal_base(bool lockFreeEmission, const Allocator_type &allocator);
 
     /**
      * @brief   Destroys the signal, and terminates all
@@ -113,12 +139,90 @@ public:
      */
     virtual void clear() = 0;
 
+    /**
+     * @brief   Disconnects a slot indicated by a pointer to it.
+     * @details This function is not designed for client code, and
+     *          is used for disconnection by connection objects.
+     * @param   slot Pointer to the slot.
+     */
+    virtual void disconnect(const slot_base* slot) = 0;
+
 protected:
+    /**
+     * @brief   Returns the invalidation counter of the signal.
+     * @details The counter is created upon the first call, and
+     *          is shared with the validators of connected slots,
+     *          which increment it when they are invalidated.
+     *          Must be called with the signal locked.
+     * @param   allocator The allocator of the counter.
+     * @return  Pointer to the invalidation counter.
+     */
+    template<class Allocator_type>
+    HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> getInvalidationCounter(
+            const Allocator_type &allocator);
+
+    /**
+     * @brief   Returns whether connected slots have been
+     *          invalidated since the last sweep.
+     * @details Must be called with the signal locked, unless
+     *          its threading policy emits without locking.
+     * @return  True if there are invalidated slots to sweep.
+     */
+    bool hasInvalidated() const;
+
+    /**
+     * @brief   Resets the invalidation counter of the signal.
+     * @details Must be called with the mutex of the signal
+     *          locked, before sweeping invalidated slots.
+     */
+    void resetInvalidated();
+
+    /**
+     * @brief   Helper struct selecting the type in which a
+     *          copy of an emitted argument is passed to a slot.
+     * @details Arguments taken by lvalue reference are passed
+     *          on as is, others are copied into a temporary.
+     */
+    template<class Arg_type>
+    struct copied_argument
+    {
+        typedef typename std::conditional<
+                    std::is_lvalue_reference<Arg_type>::value,
+                    Arg_type,
+                    typename std::remove_cv<
+                        typename std::remove_reference<Arg_type>::type>::type
+                >::type type;
+    };
+
+    /**
+     * @brief   Passes an emitted argument to a slot, which is
+     *          not the last one to be activated.
+     * @details The argument is left intact for the last slot,
+     *          which takes it over by moving it.
+     * @param   arg The emitted argument.
+     * @return  Copy of the argument, or the argument itself
+     *          if it is taken by lvalue reference.
+     */
+    template<class Arg_type>
+    static typename copied_argument<Arg_type>::type copyArgument(
+            typename std::remove_reference<Arg_type>::type &arg);
+
+    /**
+     * @brief   Finds the last slot of an emission.
+     * @details Removed slots at the end of the range are skipped.
+     * @param   begin The first slot in the order of emission.
+     * @param   end The end of the range.
+     * @return  Iterator to the last slot, or end if there
+     *          are no slots in the range.
+     */
+    template<class Iterator_type>
+    static Iterator_type findLastSlot(Iterator_type begin, Iterator_type end);
+
     /**< The blocking state of the signal */
-    bool m_blocked;
+    std::atomic<bool> m_blocked;
 
-    /**< Mutex used for synchronisation */
-    mutable HYDROSIG_MUTEX_TYPE m_mutex;
+    /**< The counter of invalidated slots */
+    HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> m_invalidated;
 
 };
 
@@ -130,10 +234,16 @@ protected:
  * -------------------
  */
 
-inline signal_base::signal_base()
-    : m_blocked(false)
+template<class Allocator_type>
+signal_base::signal_base(bool lockFreeEmission, const Allocator_type &allocator)
+    : m_blocked(false),
+      m_invalidated(nullptr)
 {
-    ;
+    if(lockFreeEmission)
+    {
+        // Emission reads the counter without locking
+        getInvalidationCounter(allocator);
+    }
 }
 
 inline signal_base::~signal_base()
@@ -143,17 +253,65 @@ inline signal_base::~signal_base()
 
 inline bool signal_base::isBlocked() const
 {
-    return m_blocked;
+    return m_blocked.load(std::memory_order_relaxed);
 }
 
 inline void signal_base::block(bool shouldBlock)
 {
-    m_blocked = shouldBlock;
+    m_blocked.store(shouldBlock, std::memory_order_relaxed);
 }
 
 inline void signal_base::unblock()
 {
-    m_blocked = false;
+    m_blocked.store(false, std::memory_order_relaxed);
+}
+
+template<class Allocator_type>
+HYDROSIG_SHARED_PTR_TYPE<invalidation_counter>
+signal_base::getInvalidationCounter(const Allocator_type &allocator)
+{
+    if(m_invalidated == nullptr)
+    {
+        m_invalidated = std::allocate_shared<invalidation_counter>(allocator, 0);
+    }
+
+    return m_invalidated;
+}
+
+inline bool signal_base::hasInvalidated() const
+{
+    if(m_invalidated == nullptr) return false;
+
+    return (m_invalidated->load(std::memory_order_relaxed) != 0);
+}
+
+inline void signal_base::resetInvalidated()
+{
+    if(m_invalidated == nullptr) return;
+
+    m_invalidated->store(0, std::memory_order_relaxed);
+}
+
+template<class Arg_type>
+typename signal_base::copied_argument<Arg_type>::type signal_base::copyArgument(
+        typename std::remove_reference<Arg_type>::type &arg)
+{
+    return arg;
+}
+
+template<class Iterator_type>
+Iterator_type signal_base::findLastSlot(Iterator_type begin, Iterator_type end)
+{
+    Iterator_type it(end);
+
+    while(it != begin)
+    {
+        --it;
+
+        if(*it != nullptr) return it;
+    }
+
+    return end;
 }
 
 
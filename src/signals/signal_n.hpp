@@ -0,0 +1,2439 @@
+#pragma once
+#ifndef HYDROSIG_SIGNAL_N_HPP_INCLUDED
+#define HYDROSIG_SIGNAL_N_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "src/macros.h"
+#include "src/signals/signal_base/signal_base.h"
+#include "src/signals/slot_storage/slot_storage.hpp"
+#include "src/signals/slot_storage/slot_publisher.hpp"
+#include "src/signals/slot_storage/fixed_slot_storage.hpp"
+#include "src/signals/slot_storage/slot_index.hpp"
+#include "src/delegates/delegate_n.hpp"
+#include "src/slots/slot_n.hpp"
+#include "src/slots/allocated_slot.hpp"
+#include "src/connections/connection_n.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+/**
+ * Forward declarations:
+ * ---------------------
+ */
+
+template<class Signature>
+class connection_n;
+
+template<class Signal_type>
+class signal_transaction;
+
+template<class Signature,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+class signal_n_base;
+
+template<class Signature,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+class signal_n;
+
+
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class forms the base of signal types
+ *          with any number of arguments. It is responsible for
+ *          implementing the connection and disconnection
+ *          mechanism, construction and copy/move semantics.
+ */
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+class signal_n_base<HYDROSIG_SIGNAL_N_ARG> : public signal_base
+{
+    /**< Friend declaration for signal_transactions */
+    template<class Signal_type>
+    friend class signal_transaction;
+
+public:
+    /**< Typedef for the slot type */
+    typedef slot_n<HYDROSIG_N_ARG>
+    slot_type;
+
+    /**< Typedef for the delegate type */
+    typedef typename slot_type::delegate_type
+    delegate_type;
+
+    /**< Typedef for the connection type */
+    typedef connection_n<HYDROSIG_N_ARG>
+    connection_type;
+
+    /**< Typedef for the storage of slots */
+    typedef typename slot_storage_selector<slot_type,
+                                           Threading_policy,
+                                           Allocator_type>::type
+    storage_type;
+
+    /**< Typedef for the list of slots */
+    typedef typename storage_type::slot_list
+    slot_list;
+
+    /**< Typedef for the immutable snapshot of slots */
+    typedef typename storage_type::snapshot_type
+    slot_snapshot;
+
+    /**< Typedef for the allocator type */
+    typedef Allocator_type
+    allocator_type;
+
+    /**
+     * @brief   Constructs a signal_n object.
+     */
+    signal_n_base();
+
+    /**
+     * @brief   Constructs a signal_n object, which allocates
+     *          its slots and their storage trough a copy of
+     *          the given allocator.
+     * @details The mutexes of serialised slots, and the lifetime
+     *          tokens of trackable objects first connected to
+     *          this signal are allocated trough it as well.
+     * @param   allocator The allocator to use.
+     */
+    explicit signal_n_base(const Allocator_type &allocator);
+
+    /**
+     * @brief   Constructs a signal_n_base object by copying src.
+     * @details Signals with connected slots are not meant
+     *          to be copied, and should be only done so when
+     *          the object encapsulating it is being copied.
+     *          Established connections are not copied into the
+     *          new object, and it is set into a default state.
+     *          The allocator is selected as containers do
+     *          upon copy construction.
+     * @param   src The signal object to copy.
+     */
+    signal_n_base(const signal_n_base &src);
+
+    /**
+     * @brief   Constructs a signal_n by moving src.
+     * @details In the moving process src loses all of
+     *          it's connections, they are transferred
+     *          to this signal. The state of the constructed
+     *          signal is matching the state of src before
+     *          the move construction.
+     * @param   src The signal to move.
+     */
+    signal_n_base(signal_n_base&& src);
+
+    /**
+     * @brief   Copy assigns src to this signal.
+     * @details Signals with connected slots are not meant
+     *          to be copied, and should be only done so when
+     *          the object encapsulating it is being copied.
+     *          Established connections are not copied into the
+     *          new object, and it is set into a default state.
+     * @param   src The signal object to copy.
+     */
+    signal_n_base& operator=(const signal_n_base& /*src*/);
+
+    /**
+     * @brief   Move assigns src to this signal.
+     * @details In the moving process src loses all of
+     *          it's connections, they are transferred
+     *          to this signal. The state of the constructed
+     *          signal is matching the state of src before
+     *          the move assignment.
+     * @param   src The signal to move.
+     */
+    signal_n_base& operator=(signal_n_base&& src);
+
+    /**
+     * @brief   Destroys the signal_n.
+     */
+    virtual ~signal_n_base();
+
+    /**
+     * @brief   Returns the number of connected slots.
+     * @details Once a slot of a trackable object was connected,
+     *          the slots are counted one by one, leaving out the
+     *          slots of destroyed objects not yet swept.
+     * @return  The number of connected slots.
+     */
+    unsigned int size() const;
+
+    /**
+     * @brief   Returns whether there are no slots
+     *          are connected to the signal.
+     * @return  True if there are no slots connected,
+     *          false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief   Removes all slots connected to the signal.
+     */
+    void clear();
+
+    /**
+     * @brief   Returns the allocator of the signal.
+     * @return  Copy of the allocator.
+     */
+    Allocator_type getAllocator() const;
+
+    /**
+     * @brief   Enables or disables the index of connected slots.
+     * @details While enabled, disconnecting a free function or a
+     *          member function of an object finds the matching slots
+     *          trough an index keyed by the target, instead of
+     *          inspecting every connected slot. Enable it for
+     *          signals with many slots, which are disconnected by
+     *          their targets. Maintaining the index costs an
+     *          allocation upon each connection.
+     * @param   shouldIndex Whether the index should be enabled.
+     */
+    void index(bool shouldIndex = true);
+
+    /**
+     * @brief   Returns whether the index of connected slots
+     *          is enabled.
+     * @return  True if the index is enabled.
+     */
+    bool isIndexed() const;
+
+    /**
+     * @brief   Connects a free function to the signal.
+     * @param   function Pointer to the free function.
+     */
+    connection_type connect(Return_type(*function)(
+                                Arg_types... args));
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with no specifiers) to the signal.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_UNTRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args));
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with no specifiers) to the signal.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_TRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args));
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with const specifier) to the signal.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_UNTRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args) const);
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with const specifier) to the signal.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_TRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args) const);
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with volatile specifier) to the signal.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_UNTRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args) volatile);
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with volatile specifier) to the signal.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_TRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args) volatile);
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with const volatile specifiers) to the signal.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_UNTRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args) const volatile);
+
+    /**
+     * @brief   Connects an object and it's member function
+     *          (with const volatile specifiers) to the signal.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     */
+    HYDROSIG_CONNECT_ENABLER_TRACKABLE
+    connect(Object_type* object,
+            Return_type(Object_type::*function)(
+                Arg_types... args) const volatile);
+
+    /**
+     * @brief   Connects a callable object to the signal.
+     * @details A copy of the callable object is made
+     *          and stored in the created slot.
+     * @param   callable The callable object.
+     */
+    template<class Callable_type>
+    connection_type connect(Callable_type callable);
+
+    /**
+     * @brief   Disconnects a free function indicated by
+     *          a pointer to it.
+     * @param   function Pointer to the free function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    void disconnect(Return_type(*function)(
+                        Arg_types... args),
+                    bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with no
+     *          specifiers of the given object.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args),
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with no
+     *          specifiers of the given object.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args),
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with const
+     *          specifier of the given object.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args) const,
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with const
+     *          specifier of the given object.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args) const,
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with volatile
+     *          specifier of the given object.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args) volatile,
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with volatile
+     *          specifier of the given object.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args) volatile,
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with const
+     *          volatile specifier of the given object.
+     * @details This version is used for untrackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args) const volatile,
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a member function with const
+     *          volatile specifier of the given object.
+     * @details This version is used for trackable objects.
+     * @param   object Pointer to the object.
+     * @param   function Pointer to the member function.
+     * @param   disconnectAll Whether all matching connections
+     *                        should be disconnected, or only
+     *                        the first match.
+     */
+    HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+    disconnect(Object_type* object,
+               Return_type(Object_type::*function)(
+                   Arg_types... args) const volatile,
+               bool disconnectAll = false);
+
+    /**
+     * @brief   Disconnects a slot indicated by a pointer to it.
+     * @details This function is not designed for client code, and
+     *          is used for disconnection by connection objects.
+     *          The slot is found by its position in the storage,
+     *          so this takes constant time.
+     * @param   slot Pointer to the slot.
+     */
+    void disconnect(const slot_base* slot) override;
+
+    /**
+     * @brief   Removes all invalidated slots from the slot-list.
+     * @details This function is used upon signal emission, to
+     *          remove invalidated slots before emitting, but only
+     *          when slots were invalidated since the last sweep.
+     *          You may need to call this function manually when
+     *          you have objects connected to the signal which are
+     *          frequently destroyed without manual disconnection.
+     *          Otherwise, such connections are skipped by the next
+     *          emission, and automatically cleaned up by the one
+     *          after it.
+     */
+    void removeInvalidated();
+
+protected:
+    /**
+     * @brief   Begins a transaction on the signal.
+     * @details Locks the signal, and lets the calling thread manage
+     *          its connections without locking it again, until the
+     *          transaction ends. The modifications are published
+     *          together at the end of the transaction. Does nothing
+     *          if the calling thread already runs a transaction on
+     *          the signal.
+     * @param   reserve The number of connections expected to be
+     *                  made, for which room is made at once.
+     * @return  True if a transaction was begun.
+     */
+    bool beginTransaction(unsigned int reserve);
+
+    /**
+     * @brief   Ends the transaction begun by the calling thread,
+     *          publishes its modifications and unlocks the signal.
+     */
+    void endTransaction();
+
+    /**
+     * @brief   Returns whether the calling thread runs a
+     *          transaction on the signal.
+     * @details Reads the owner of the transaction without locking,
+     *          the only thread which may find itself there is the
+     *          one which stored itself.
+     * @return  True if the calling thread runs a transaction.
+     */
+    bool ownsTransaction() const;
+
+    /**
+     * @brief   Takes a snapshot of the connected slots for emission.
+     * @details Invalidated slots are swept first, if there are any.
+     *          The snapshot is taken with shared access to the
+     *          signal, exclusive access is only taken to sweep.
+     *          If the threading policy emits without locking, the
+     *          sweep is skipped while the signal is locked by
+     *          someone else, and the snapshot is taken without
+     *          locking.
+     * @return  The snapshot of the connected slots.
+     */
+    slot_snapshot takeSnapshot();
+
+    /**
+     * @brief   Counts the valid slots in a snapshot.
+     * @param   snapshot The snapshot of the connected slots.
+     * @return  The number of valid slots.
+     */
+    static unsigned int countValid(const slot_snapshot &snapshot);
+
+    /**
+     * @brief   Creates a slot holding the given delegate.
+     * @details The slot, and its mutex once it is serialised,
+     *          are allocated trough the allocator of the signal.
+     *          Must be called with the signal locked.
+     * @param   delegate The delegate to the target of the slot.
+     * @return  Pointer to the created slot.
+     */
+    HYDROSIG_SHARED_PTR_TYPE<slot_type> createSlot(delegate_type &&delegate);
+
+    /**
+     * @brief   Removes all invalidated slots from the slot-list.
+     * @details Must be called with the signal locked.
+     */
+    void sweepInvalidated();
+
+    /**
+     * @brief   Appends the given slot to the slot-list, and
+     *          inserts it into the index.
+     * @details Invalidated slots, and the slots of destroyed
+     *          trackable objects are swept first, if the storage
+     *          is full, or slots were invalidated since the last
+     *          sweep. Must be called with the signal locked.
+     * @param   slot The slot to append.
+     */
+    void appendSlot(const HYDROSIG_SHARED_PTR_TYPE<slot_type> &slot);
+
+    /**
+     * @brief   Removes the slots whose delegate compares equal
+     *          to the supplied one.
+     * @details The slots are found trough the index if it is
+     *          enabled. Must be called with the signal locked.
+     * @param   supplied The delegate to compare with.
+     * @param   removeAll Whether all matching slots should be
+     *                    removed, or only the first match.
+     */
+    void removeMatching(const delegate_type &supplied,
+                        bool removeAll);
+
+    /**< The storage of slots */
+    storage_type m_slots;
+
+    /**< The index of slots, keyed by their targets */
+    slot_index<slot_type, Allocator_type> m_index;
+
+    /**< Mutex used for synchronisation */
+    mutable typename Threading_policy::mutex_type m_mutex;
+
+    /**< The thread running a transaction on the signal, if any */
+    std::atomic<std::thread::id> m_transactionOwner;
+
+    /**< Whether a slot of a trackable object was ever connected */
+    std::atomic<bool> m_tracking;
+
+};
+
+/**
+ * @brief   This class represents signals with any number of arguments,
+ *          using the normal (non-returning) emission mode.
+ */
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+class signal_n<HYDROSIG_SIGNAL_N_ARG> : public signal_n_base<HYDROSIG_SIGNAL_N_ARG>
+{
+public:
+    /**< Inherits the constructors taking an allocator */
+    using signal_n_base<HYDROSIG_SIGNAL_N_ARG>::signal_n_base;
+
+    /**< Typedef for the slot type */
+    typedef slot_n<HYDROSIG_N_ARG>
+    slot_type;
+
+    /**< Typedef for the storage of slots */
+    typedef typename slot_storage_selector<slot_type,
+                                           Threading_policy,
+                                           Allocator_type>::type
+    storage_type;
+
+    /**< Typedef for the list of slots */
+    typedef typename storage_type::slot_list
+    slot_list;
+
+    /**< Typedef for the immutable snapshot of slots */
+    typedef typename storage_type::snapshot_type
+    slot_snapshot;
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in the exact same
+     *          order they were connected to the signal.
+     * @param   args The arguments.
+     */
+    void emit(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in reverse order
+     *          of they were connected to the signal.
+     * @param   args The arguments.
+     */
+    void emit_reverse(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in the exact same
+     *          order they were connected to the signal.
+     *          This is a convenience function, which
+     *          calls emit().
+     * @param   args The arguments.
+     */
+    void operator()(Arg_types... args);
+
+    /**< Nested class for emitting signals with collected results */
+    class collected;
+
+    /**< Nested class for emitting signals with combined results */
+    template<class Combiner_type>
+    class combined;
+
+};
+
+/**
+ * @brief   This class represents signals with any number of arguments,
+ *          using the collected emission mode.
+ * @details Collected emission means, that the emitting
+ *          functions return a list of the return values
+ *          of slot activations.
+ */
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+class signal_n<HYDROSIG_SIGNAL_N_ARG>::collected : public signal_n_base<HYDROSIG_SIGNAL_N_ARG>
+{
+    static_assert(!std::is_same<Return_type, void>::value,
+                  "Return values with type 'void' can not be collected.");
+
+public:
+    /**< Typedef for the list of collected results */
+    typedef HYDROSIG_LIST_TYPE<Return_type,
+                               typename std::allocator_traits<Allocator_type>
+                               ::template rebind_alloc<Return_type>>
+    result_list;
+
+    /**< Inherits the constructors taking an allocator */
+    using signal_n_base<HYDROSIG_SIGNAL_N_ARG>::signal_n_base;
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in the exact same
+     *          order they were connected to the signal.
+     * @param   args The arguments.
+     * @return  The list of returned values from each slot
+     *          activation.
+     */
+    result_list emit(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in reverse order
+     *          of they were connected to the signal.
+     * @param   args The arguments.
+     * @return  The list of returned values from each slot
+     *          activation.
+     */
+    result_list emit_reverse(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in the exact same
+     *          order they were connected to the signal.
+     *          This is a convenience function, which
+     *          calls emit().
+     * @param   args The arguments.
+     * @return  The list of returned values from each slot
+     *          activation.
+     */
+    result_list operator()(Arg_types... args);
+
+};
+
+/**
+ * @brief   This class represents signals with any number of arguments,
+ *          using the combined emission mode.
+ * @details Combined emission means, that the emitting
+ *          functions return a combined result of the
+ *          return values of slot activations using a
+ *          custom combiner.
+ *          The combiner held by the signal is a prototype:
+ *          every emission combines with its own copy of it,
+ *          so concurrent emissions never share a combiner.
+ *          The prototype is published to emission trough a
+ *          slot_publisher, therefore it can be replaced
+ *          while the signal is emitted without locking.
+ */
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+class signal_n<HYDROSIG_SIGNAL_N_ARG>::combined
+        : public signal_n_base<HYDROSIG_SIGNAL_N_ARG>
+{
+    static_assert(!std::is_same<Return_type, void>::value,
+                  "Return values with type 'void' can not be combined.");
+
+public:
+    /**
+     * @brief   Constructs a combined signal with a
+     *          default combiner.
+     */
+    combined();
+
+    /**
+     * @brief   Constructs a combined signal with a
+     *          copy of the supplied combiner.
+     * @param   combiner The combiner to use.
+     */
+    combined(const Combiner_type &combiner);
+
+    /**
+     * @brief   Constructs a combined signal with a
+     *          default combiner, using the supplied
+     *          allocator.
+     * @param   allocator The allocator to use.
+     */
+    explicit combined(const Allocator_type &allocator);
+
+    /**
+     * @brief   Constructs a combined signal with a
+     *          copy of the supplied combiner, using
+     *          the supplied allocator.
+     * @param   combiner The combiner to use.
+     * @param   allocator The allocator to use.
+     */
+    combined(const Combiner_type &combiner,
+             const Allocator_type &allocator);
+
+    /**
+     * @brief   Constructs a combined signal by
+     *          copying src.
+     * @details The combiner is being copied, for
+     *          other members, signal_base copy
+     *          semantics are applied.
+     * @param   src The other combined signal to copy.
+     */
+    combined(const combined &src);
+
+    /**
+     * @brief   Constructs a combined signal by
+     *          moving src.
+     * @details The combiner is being moved, for
+     *          other members, signal_base move
+     *          semantics are applied.
+     * @param   src The other combined signal to move.
+     */
+    combined(combined &&src);
+
+    /**
+     * @brief   Copy assigns src to this combined signal.
+     * @details The combiner is being copied, for
+     *          other members, signal_base copy
+     *          semantics are applied.
+     * @param   src The other combined signal to copy
+     *              assign from.
+     */
+    combined& operator=(const combined &src);
+
+    /**
+     * @brief   Move assigns src to this combined signal.
+     * @details The combiner is being moved, for
+     *          other members, signal_base move
+     *          semantics are applied.
+     * @param   src The other combined signal to move
+     *              assign from.
+     */
+    combined& operator=(combined &&src);
+
+    /**
+     * @brief   Returns the combiner object used by
+     *          the combined signal.
+     * @details Emissions copy this combiner, modifying
+     *          it while the signal is emitted on other
+     *          threads is not synchronised. Use
+     *          setCombiner() instead.
+     * @return  The internal combiner.
+     */
+    Combiner_type& getCombiner();
+
+    /**
+     * @brief   Sets the combiner used by the
+     *          combined signal.
+     * @details A copy of the combiner is published to
+     *          emission, replacing the previous one.
+     *          Emissions already running keep their own
+     *          copy of the previous combiner.
+     * @param   combiner The combiner to set.
+     */
+    void setCombiner(const Combiner_type &combiner);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in the exact same
+     *          order they were connected to the signal.
+     * @param   args The arguments.
+     * @return  The combined result of the return values
+     *          of slot activations.
+     */
+    Return_type emit(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in reverse order
+     *          of they were connected to the signal.
+     * @param   args The arguments.
+     * @return  The combined result of the return values
+     *          of slot activations.
+     */
+    Return_type emit_reverse(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal by activating all of the
+     *          connected slot's callback functions.
+     * @details The slots are activated in the exact same
+     *          order they were connected to the signal.
+     *          This is a convenience function, which
+     *          calls emit().
+     * @param   args The arguments.
+     * @return  The combined result of the return values
+     *          of slot activations.
+     */
+    Return_type operator()(Arg_types... args);
+
+protected:
+    /**< Typedef for the publisher of the combiner */
+    typedef slot_publisher<Combiner_type, true, Allocator_type>
+    combiner_publisher;
+
+    /**
+     * @brief   Returns a copy of the published combiner,
+     *          for a single emission.
+     * @details May be called without locking.
+     * @return  The copy of the combiner.
+     */
+    Combiner_type copyCombiner() const;
+
+    /**< The combiner used by the signal */
+    HYDROSIG_SHARED_PTR_TYPE<Combiner_type> m_combiner;
+
+    /**< The publisher of the combiner to emission */
+    combiner_publisher m_publisher;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::signal_n_base()
+    : signal_base(Threading_policy::lock_free_emission, Allocator_type()),
+      m_slots(Allocator_type()),
+      m_index(Allocator_type()),
+      m_transactionOwner(std::thread::id()),
+      m_tracking(false)
+{
+    ;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::signal_n_base(
+        const Allocator_type &allocator)
+    : signal_base(Threading_policy::lock_free_emission, allocator),
+      m_slots(allocator),
+      m_index(allocator),
+      m_transactionOwner(std::thread::id()),
+      m_tracking(false)
+{
+    ;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::signal_n_base(
+        const signal_n_base &src)
+    : signal_n_base(std::allocator_traits<Allocator_type>
+                     ::select_on_container_copy_construction(src.getAllocator()))
+{
+    // Do not copy the list of slots
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::signal_n_base(
+        signal_n_base&& src)
+    : signal_base(Threading_policy::lock_free_emission, src.getAllocator()),
+      m_slots(src.getAllocator()),
+      m_index(src.getAllocator()),
+      m_transactionOwner(std::thread::id()),
+      m_tracking(false)
+{
+    // Move the list of slots
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN
+
+    m_slots = std::move(src.m_slots);
+    m_index = std::move(src.m_index);
+    m_tracking.store(src.m_tracking.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+    m_blocked = src.isBlocked();
+
+    // The source keeps the counter created for this signal, if any,
+    // as lock-free emission reads it without locking
+    m_invalidated.swap(src.m_invalidated);
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>& signal_n_base<HYDROSIG_SIGNAL_N_ARG>::operator=(
+        const signal_n_base& /*src*/)
+{
+    // Do not copy the list of slots
+
+    m_blocked = false;
+
+    return *this;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>& signal_n_base<HYDROSIG_SIGNAL_N_ARG>::operator=(
+        signal_n_base&& src)
+{
+    if(this == &src) return *this;
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    // Move the list of slots
+    m_slots = std::move(src.m_slots);
+    m_index = std::move(src.m_index);
+    m_invalidated = std::move(src.m_invalidated);
+    m_tracking.store(src.m_tracking.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+
+    // Lock-free emission of the source reads its counter without locking
+    if(Threading_policy::lock_free_emission)
+    {
+        src.getInvalidationCounter(src.getAllocator());
+    }
+
+    // Copy the blocking state
+    m_blocked = src.isBlocked();
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END
+
+    return *this;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::~signal_n_base()
+{
+    ;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+unsigned int signal_n_base<HYDROSIG_SIGNAL_N_ARG>::size() const
+{
+    if(!m_tracking.load(std::memory_order_relaxed)) return m_slots.size();
+
+    if(Threading_policy::lock_free_emission) return countValid(m_slots.snapshot());
+
+    HYDROSIG_SIGNAL_SHARED_BLOCK_BEGIN
+
+    return countValid(m_slots.snapshot());
+
+    // HYDROSIG_SIGNAL_SHARED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+bool signal_n_base<HYDROSIG_SIGNAL_N_ARG>::empty() const
+{
+    return (size() == 0);
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+Allocator_type signal_n_base<HYDROSIG_SIGNAL_N_ARG>::getAllocator() const
+{
+    return m_slots.getAllocator();
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::clear()
+{
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    m_slots.clear();
+    m_index.clear();
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::index(bool shouldIndex)
+{
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    if(!shouldIndex)
+    {
+        m_index.disable();
+        return;
+    }
+
+    if(m_index.isEnabled()) return;
+
+    m_index.enable();
+
+    try {
+        // Index the slots connected so far
+        slot_snapshot snapshot = m_slots.snapshot();
+
+        typename slot_snapshot::const_iterator itBegin(snapshot.begin());
+        typename slot_snapshot::const_iterator itEnd(snapshot.end());
+
+        while(itBegin != itEnd)
+        {
+            if(*itBegin != nullptr) m_index.insert(itBegin->get());
+            itBegin++;
+        }
+    }
+    catch(...)
+    {
+        m_index.disable();
+        throw;
+    }
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+bool signal_n_base<HYDROSIG_SIGNAL_N_ARG>::isIndexed() const
+{
+    HYDROSIG_SIGNAL_SHARED_BLOCK_BEGIN
+
+    return m_index.isEnabled();
+
+    // HYDROSIG_SIGNAL_SHARED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+typename signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connection_type
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(
+        Return_type(*function)(Arg_types... args))
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(function));
+        validator = newSlot->getValidator();
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args))
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args))
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+        validator->track(object->getLifetimeToken(m_slots.getAllocator()));
+        m_tracking.store(true, std::memory_order_relaxed);
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args) const)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args) const)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+        validator->track(object->getLifetimeToken(m_slots.getAllocator()));
+        m_tracking.store(true, std::memory_order_relaxed);
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args) volatile)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args) volatile)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+        validator->track(object->getLifetimeToken(m_slots.getAllocator()));
+        m_tracking.store(true, std::memory_order_relaxed);
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_UNTRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args) const volatile)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_CONNECT_ENABLER_TRACKABLE_IMPL_N
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Object_type* object,
+                                       Return_type(Object_type::*function)(
+                                           Arg_types... args) const volatile)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(object, function));
+        validator = newSlot->getValidator();
+        validator->track(object->getLifetimeToken(m_slots.getAllocator()));
+        m_tracking.store(true, std::memory_order_relaxed);
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Callable_type>
+typename signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connection_type
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::connect(Callable_type callable)
+{
+    HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator;
+
+    try {
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+        HYDROSIG_SHARED_PTR_TYPE<slot_type> newSlot =
+                createSlot(delegate_type(std::move(callable),
+                                         m_slots.getAllocator()));
+        validator = newSlot->getValidator();
+
+        appendSlot(newSlot);
+
+        HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+
+        return connection_type(newSlot,this,validator);
+    }
+    catch(...)
+    {
+        throw connection_failure();
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Return_type(*function)(
+                                                   Arg_types... args),
+                                               bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args),
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args),
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args) const,
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args) const,
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args) volatile,
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args) volatile,
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_UNTRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args) const volatile,
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_DISCONNECT_ENABLER_TRACKABLE
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(Object_type* object,
+                                          Return_type(Object_type::*function)(
+                                              Arg_types... args) const volatile,
+                                          bool disconnectAll)
+{
+    // Delegate to the supplied function
+    delegate_type supplied(object,function);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    removeMatching(supplied, disconnectAll);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::disconnect(
+        const slot_base* slot)
+{
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    // Connections only refer to slots of this signal type
+    const slot_type* connected = static_cast<const slot_type*>(slot);
+
+    m_index.erase(connected);
+    m_slots.remove(connected);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::removeInvalidated()
+{
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    sweepInvalidated();
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+bool signal_n_base<HYDROSIG_SIGNAL_N_ARG>::beginTransaction(unsigned int reserve)
+{
+    if(ownsTransaction()) return false;
+
+    m_mutex.lock();
+
+    try {
+        m_slots.beginBatch(reserve);
+    }
+    catch(...)
+    {
+        m_mutex.unlock();
+        throw;
+    }
+
+    m_transactionOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    return true;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::endTransaction()
+{
+    m_transactionOwner.store(std::thread::id(), std::memory_order_relaxed);
+
+    try {
+        m_slots.endBatch();
+    }
+    catch(...)
+    {
+        m_mutex.unlock();
+        throw;
+    }
+
+    m_mutex.unlock();
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+bool signal_n_base<HYDROSIG_SIGNAL_N_ARG>::ownsTransaction() const
+{
+    std::thread::id owner = m_transactionOwner.load(std::memory_order_relaxed);
+
+    // The calling thread is only looked up while a transaction runs
+    return (owner != std::thread::id() && owner == std::this_thread::get_id());
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+typename signal_n_base<HYDROSIG_SIGNAL_N_ARG>::slot_snapshot
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::takeSnapshot()
+{
+    if(Threading_policy::lock_free_emission)
+    {
+        // Wait-free emission leaves the sweep to connection management
+        if(!Threading_policy::wait_free_emission && this->hasInvalidated())
+        {
+            // Never wait for connection management to sweep
+            typename Threading_policy::lock_type guard(this->m_mutex,
+                                                       std::try_to_lock);
+
+            if(guard.owns_lock()) sweepInvalidated();
+        }
+
+        return m_slots.snapshot();
+    }
+
+    {
+        HYDROSIG_SIGNAL_SHARED_BLOCK_BEGIN
+
+        // Concurrent emissions only read the list of slots
+        if(!this->hasInvalidated()) return m_slots.snapshot();
+
+        HYDROSIG_SIGNAL_SHARED_BLOCK_END
+    }
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    // Someone else may have swept since the shared access
+    if(this->hasInvalidated()) sweepInvalidated();
+
+    return m_slots.snapshot();
+
+    // HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+unsigned int signal_n_base<HYDROSIG_SIGNAL_N_ARG>::countValid(const slot_snapshot &snapshot)
+{
+    // Destroyed objects do not notify the signal, their slots are left out here
+    unsigned int count = 0;
+
+    typename slot_snapshot::const_iterator itBegin(snapshot.begin());
+    typename slot_snapshot::const_iterator itEnd(snapshot.end());
+
+    while(itBegin != itEnd)
+    {
+        if(*itBegin != nullptr && (*itBegin)->isValid()) count++;
+        itBegin++;
+    }
+
+    return count;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+HYDROSIG_SHARED_PTR_TYPE<typename signal_n_base<HYDROSIG_SIGNAL_N_ARG>::slot_type>
+signal_n_base<HYDROSIG_SIGNAL_N_ARG>::createSlot(delegate_type &&delegate)
+{
+    Allocator_type allocator(m_slots.getAllocator());
+
+    // The slot holds its validator, a single allocation is made
+    return std::allocate_shared<allocated_slot<slot_type, Allocator_type>>(
+                allocator,
+                allocator,
+                std::move(delegate),
+                this->getInvalidationCounter(allocator));
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::sweepInvalidated()
+{
+    // Slots invalidated during the sweep are swept next time
+    this->resetInvalidated();
+
+    m_slots.removeIf([this](const HYDROSIG_SHARED_PTR_TYPE<slot_type> &slot) -> bool
+    {
+        if(slot->isValid()) return false;
+
+        m_index.erase(slot.get());
+        return true;
+    }, true);
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::appendSlot(
+        const HYDROSIG_SHARED_PTR_TYPE<slot_type> &slot)
+{
+    // Slots of destroyed objects may take up the capacity of fixed storages
+    if(this->hasInvalidated() || m_slots.isFull()) sweepInvalidated();
+
+    m_index.insert(slot.get());
+
+    try {
+        m_slots.append(slot);
+    }
+    catch(...)
+    {
+        m_index.erase(slot.get());
+        throw;
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n_base<HYDROSIG_SIGNAL_N_ARG>::removeMatching(
+        const delegate_type &supplied,
+        bool removeAll)
+{
+    std::size_t hash = supplied.hash();
+
+    if(!m_index.isEnabled() || hash == 0)
+    {
+        m_slots.removeIf([&](const HYDROSIG_SHARED_PTR_TYPE<slot_type> &slot) -> bool
+        {
+            // Comparing delegates
+            return (slot->getDelegate() == supplied);
+        }, removeAll);
+
+        return;
+    }
+
+    if(!removeAll)
+    {
+        // Only the earliest connected match is removed
+        slot_type* slot = m_index.find(hash, [&](const slot_type &indexed) -> bool
+        {
+            return indexed.getDelegate() == supplied;
+        });
+
+        if(slot == nullptr) return;
+
+        m_index.erase(slot);
+        m_slots.remove(slot);
+        return;
+    }
+
+    m_index.eraseIf(hash, [&](slot_type &indexed) -> bool
+    {
+        if(indexed.getDelegate() != supplied) return false;
+
+        // The slot may be destroyed here, the index no longer needs it
+        m_slots.remove(&indexed);
+        return true;
+    });
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n<HYDROSIG_SIGNAL_N_ARG>::emit(Arg_types... args)
+{
+    // Blocked and unconnected signals return without locking
+    if(this->isBlocked() || this->empty()) return;
+
+    slot_snapshot snapshot = this->takeSnapshot();
+
+    if(snapshot.empty()) return;
+
+    typename slot_snapshot::const_iterator itBegin(snapshot.begin());
+    typename slot_snapshot::const_iterator itEnd(snapshot.end());
+    typename slot_snapshot::const_iterator itLast(
+            signal_base::findLastSlot(itBegin, itEnd));
+
+    while(itBegin != itEnd)
+    {
+        // Skip the slot if removed
+        if(*itBegin == nullptr)
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Skip the slot if invalid, blocked, or
+        // busy according to its concurrency policy
+        slot_base::activation_guard activation(**itBegin);
+
+        if(!activation.isActive())
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Activating the slot, the last one takes
+        // over the arguments instead of a copy
+        try {
+            if(itBegin == itLast)
+            {
+                (*itBegin)->activate(std::forward<Arg_types>(args)...);
+            }
+            else
+            {
+                (*itBegin)->activate(signal_base::copyArgument<Arg_types>(args)...);
+            }
+
+            itBegin++;
+        }
+        catch(...)
+        {
+            throw;
+        }
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n<HYDROSIG_SIGNAL_N_ARG>::emit_reverse(Arg_types... args)
+{
+    // Blocked and unconnected signals return without locking
+    if(this->isBlocked() || this->empty()) return;
+
+    slot_snapshot snapshot = this->takeSnapshot();
+
+    if(snapshot.empty()) return;
+
+    typename slot_snapshot::const_reverse_iterator itBegin(snapshot.rbegin());
+    typename slot_snapshot::const_reverse_iterator itEnd(snapshot.rend());
+    typename slot_snapshot::const_reverse_iterator itLast(
+            signal_base::findLastSlot(itBegin, itEnd));
+
+    while(itBegin != itEnd)
+    {
+        // Skip the slot if removed
+        if(*itBegin == nullptr)
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Skip the slot if invalid, blocked, or
+        // busy according to its concurrency policy
+        slot_base::activation_guard activation(**itBegin);
+
+        if(!activation.isActive())
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Activating the slot, the last one takes
+        // over the arguments instead of a copy
+        try {
+            if(itBegin == itLast)
+            {
+                (*itBegin)->activate(std::forward<Arg_types>(args)...);
+            }
+            else
+            {
+                (*itBegin)->activate(signal_base::copyArgument<Arg_types>(args)...);
+            }
+
+            itBegin++;
+        }
+        catch(...)
+        {
+            throw;
+        }
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+void signal_n<HYDROSIG_SIGNAL_N_ARG>::operator()(Arg_types... args)
+{
+    try {
+        emit(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+typename signal_n<HYDROSIG_SIGNAL_N_ARG>::collected::result_list
+signal_n<HYDROSIG_SIGNAL_N_ARG>::collected::emit(
+        Arg_types... args)
+{
+    result_list resultList(this->getAllocator());
+
+    // Blocked and unconnected signals return without locking
+    if(this->isBlocked() || this->empty()) return resultList;
+
+    slot_snapshot snapshot = this->takeSnapshot();
+
+    if(snapshot.empty()) return resultList;
+
+    typename slot_snapshot::const_iterator itBegin(snapshot.begin());
+    typename slot_snapshot::const_iterator itEnd(snapshot.end());
+    typename slot_snapshot::const_iterator itLast(
+            signal_base::findLastSlot(itBegin, itEnd));
+
+    while(itBegin != itEnd)
+    {
+        // Skip the slot if removed
+        if(*itBegin == nullptr)
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Skip the slot if invalid, blocked, or
+        // busy according to its concurrency policy
+        slot_base::activation_guard activation(**itBegin);
+
+        if(!activation.isActive())
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Activating the slot, the last one takes
+        // over the arguments instead of a copy
+        try {
+            if(itBegin == itLast)
+            {
+                resultList.push_back((*itBegin)->activate(std::forward<Arg_types>(args)...));
+            }
+            else
+            {
+                resultList.push_back((*itBegin)->activate(signal_base::copyArgument<Arg_types>(args)...));
+            }
+
+            itBegin++;
+        }
+        catch(...)
+        {
+            throw;
+        }
+    }
+
+    return resultList;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+typename signal_n<HYDROSIG_SIGNAL_N_ARG>::collected::result_list
+signal_n<HYDROSIG_SIGNAL_N_ARG>::collected::emit_reverse(
+        Arg_types... args)
+{
+    result_list resultList(this->getAllocator());
+
+    // Blocked and unconnected signals return without locking
+    if(this->isBlocked() || this->empty()) return resultList;
+
+    slot_snapshot snapshot = this->takeSnapshot();
+
+    if(snapshot.empty()) return resultList;
+
+    typename slot_snapshot::const_reverse_iterator itBegin(snapshot.rbegin());
+    typename slot_snapshot::const_reverse_iterator itEnd(snapshot.rend());
+    typename slot_snapshot::const_reverse_iterator itLast(
+            signal_base::findLastSlot(itBegin, itEnd));
+
+    while(itBegin != itEnd)
+    {
+        // Skip the slot if removed
+        if(*itBegin == nullptr)
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Skip the slot if invalid, blocked, or
+        // busy according to its concurrency policy
+        slot_base::activation_guard activation(**itBegin);
+
+        if(!activation.isActive())
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Activating the slot, the last one takes
+        // over the arguments instead of a copy
+        try {
+            if(itBegin == itLast)
+            {
+                resultList.push_back((*itBegin)->activate(std::forward<Arg_types>(args)...));
+            }
+            else
+            {
+                resultList.push_back((*itBegin)->activate(signal_base::copyArgument<Arg_types>(args)...));
+            }
+
+            itBegin++;
+        }
+        catch(...)
+        {
+            throw;
+        }
+    }
+
+    return resultList;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+typename signal_n<HYDROSIG_SIGNAL_N_ARG>::collected::result_list
+signal_n<HYDROSIG_SIGNAL_N_ARG>::collected::operator()(
+        Arg_types... args)
+{
+    try {
+        return emit(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::combined()
+    : m_combiner(std::allocate_shared<Combiner_type>(this->getAllocator())),
+      m_publisher(this->getAllocator())
+{
+    m_publisher.publish(m_combiner);
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::combined(
+        const Combiner_type &combiner)
+    : m_combiner(std::allocate_shared<Combiner_type>(this->getAllocator(),
+                                                     combiner)),
+      m_publisher(this->getAllocator())
+{
+    m_publisher.publish(m_combiner);
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::combined(
+        const Allocator_type &allocator)
+    : signal_n_base<HYDROSIG_SIGNAL_N_ARG>(allocator),
+      m_combiner(std::allocate_shared<Combiner_type>(allocator)),
+      m_publisher(allocator)
+{
+    m_publisher.publish(m_combiner);
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::combined(
+        const Combiner_type &combiner,
+        const Allocator_type &allocator)
+    : signal_n_base<HYDROSIG_SIGNAL_N_ARG>(allocator),
+      m_combiner(std::allocate_shared<Combiner_type>(allocator, combiner)),
+      m_publisher(allocator)
+{
+    m_publisher.publish(m_combiner);
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::combined(
+        const combined &src)
+    : signal_n_base<HYDROSIG_SIGNAL_N_ARG>(src),
+      m_publisher(this->getAllocator())
+{
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN
+
+    m_combiner = std::allocate_shared<Combiner_type>(this->getAllocator(),
+                                                     *(src.m_combiner));
+    m_publisher.publish(m_combiner);
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::combined(
+        combined &&src)
+    : signal_n_base<HYDROSIG_SIGNAL_N_ARG>(
+          std::forward<signal_n_base<HYDROSIG_SIGNAL_N_ARG>>(src)),
+      m_publisher(this->getAllocator())
+{
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN
+
+    m_combiner = std::move(src.m_combiner);
+    m_publisher.publish(m_combiner);
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>&
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::operator=(
+        const combined &src)
+{
+    if(this == &src) return *this;
+
+    signal_n_base<HYDROSIG_SIGNAL_N_ARG>::operator =(src);
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    m_combiner = std::allocate_shared<Combiner_type>(this->getAllocator(),
+                                                     *(src.m_combiner));
+    m_publisher.publish(m_combiner);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END
+
+    return *this;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>&
+signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::operator=(
+        combined &&src)
+{
+    if(this == &src) return *this;
+
+    signal_n_base<HYDROSIG_SIGNAL_N_ARG>::operator =(
+                std::forward<signal_n_base<HYDROSIG_SIGNAL_N_ARG>>(src));
+
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_BEGIN
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    m_combiner = std::move(src.m_combiner);
+    m_publisher.publish(m_combiner);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+    HYDROSIG_SIGNAL_REMOTE_PROTECTED_BLOCK_END
+
+    return *this;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+Combiner_type& signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::getCombiner()
+{
+    return *m_combiner;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+void signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::setCombiner(
+        const Combiner_type &combiner)
+{
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_BEGIN
+
+    // Emission may hold the previous combiner without locking
+    m_combiner = std::allocate_shared<Combiner_type>(this->getAllocator(),
+                                                     combiner);
+    m_publisher.publish(m_combiner);
+
+    HYDROSIG_SIGNAL_PROTECTED_BLOCK_END
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+Combiner_type signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::copyCombiner() const
+{
+    typename combiner_publisher::snapshot_type combiner =
+            m_publisher.snapshot(nullptr);
+
+    return *combiner;
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+Return_type signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::emit(
+        Arg_types... args)
+{
+    // Blocked and unconnected signals return without locking
+    if(this->isBlocked() || this->empty()) return copyCombiner().value();
+
+    slot_snapshot snapshot = this->takeSnapshot();
+    Combiner_type combiner(copyCombiner());
+
+    if(snapshot.empty()) return combiner.value();
+
+    typename slot_snapshot::const_iterator itBegin(snapshot.begin());
+    typename slot_snapshot::const_iterator itEnd(snapshot.end());
+    typename slot_snapshot::const_iterator itLast(
+            signal_base::findLastSlot(itBegin, itEnd));
+
+    while(itBegin != itEnd)
+    {
+        // Skip the slot if removed
+        if(*itBegin == nullptr)
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Skip the slot if invalid, blocked, or
+        // busy according to its concurrency policy
+        slot_base::activation_guard activation(**itBegin);
+
+        if(!activation.isActive())
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Activating the slot, the last one takes
+        // over the arguments instead of a copy
+        try {
+            if(itBegin == itLast)
+            {
+                combiner((*itBegin)->activate(std::forward<Arg_types>(args)...));
+            }
+            else
+            {
+                combiner((*itBegin)->activate(signal_base::copyArgument<Arg_types>(args)...));
+            }
+
+            itBegin++;
+        }
+        catch(...)
+        {
+            throw;
+        }
+    }
+
+    return combiner.value();
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+Return_type signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::emit_reverse(
+        Arg_types... args)
+{
+    // Blocked and unconnected signals return without locking
+    if(this->isBlocked() || this->empty()) return copyCombiner().value();
+
+    slot_snapshot snapshot = this->takeSnapshot();
+    Combiner_type combiner(copyCombiner());
+
+    if(snapshot.empty()) return combiner.value();
+
+    typename slot_snapshot::const_reverse_iterator itBegin(snapshot.rbegin());
+    typename slot_snapshot::const_reverse_iterator itEnd(snapshot.rend());
+    typename slot_snapshot::const_reverse_iterator itLast(
+            signal_base::findLastSlot(itBegin, itEnd));
+
+    while(itBegin != itEnd)
+    {
+        // Skip the slot if removed
+        if(*itBegin == nullptr)
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Skip the slot if invalid, blocked, or
+        // busy according to its concurrency policy
+        slot_base::activation_guard activation(**itBegin);
+
+        if(!activation.isActive())
+        {
+            itBegin++;
+            continue;
+        }
+
+        // Activating the slot, the last one takes
+        // over the arguments instead of a copy
+        try {
+            if(itBegin == itLast)
+            {
+                combiner((*itBegin)->activate(std::forward<Arg_types>(args)...));
+            }
+            else
+            {
+                combiner((*itBegin)->activate(signal_base::copyArgument<Arg_types>(args)...));
+            }
+
+            itBegin++;
+        }
+        catch(...)
+        {
+            throw;
+        }
+    }
+
+    return combiner.value();
+}
+
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
+template<class Combiner_type>
+Return_type signal_n<HYDROSIG_SIGNAL_N_ARG>::combined<Combiner_type>::operator()(
+        Arg_types... args)
+{
+    try {
+        return emit(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+
+
+/**
+ * Fixed arity aliases:
+ * --------------------
+ * Kept for code written against the per-arity signal templates.
+ */
+
+/**
+ * @brief   Signal with no arguments.
+ */
+template<class Return_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_0 = signal_n<Return_type(),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with one argument.
+ */
+template<class Return_type,
+         class Arg1_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_1 = signal_n<Return_type(Arg1_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with two arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_2 = signal_n<Return_type(Arg1_type, Arg2_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with three arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type, class Arg3_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_3 = signal_n<Return_type(Arg1_type, Arg2_type, Arg3_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with four arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type, class Arg3_type,
+         class Arg4_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_4 = signal_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with five arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type, class Arg3_type,
+         class Arg4_type, class Arg5_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_5 = signal_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                      Arg5_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with six arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type, class Arg3_type,
+         class Arg4_type, class Arg5_type, class Arg6_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_6 = signal_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                      Arg5_type, Arg6_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with seven arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type, class Arg3_type,
+         class Arg4_type, class Arg5_type, class Arg6_type,
+         class Arg7_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_7 = signal_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                      Arg5_type, Arg6_type, Arg7_type),
+                         Threading_policy, Allocator_type>;
+
+/**
+ * @brief   Signal with eight arguments.
+ */
+template<class Return_type,
+         class Arg1_type, class Arg2_type, class Arg3_type,
+         class Arg4_type, class Arg5_type, class Arg6_type,
+         class Arg7_type, class Arg8_type,
+         class Threading_policy = HYDROSIG_DEFAULT_THREADING_POLICY,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using signal_8 = signal_n<Return_type(Arg1_type, Arg2_type, Arg3_type, Arg4_type,
+                                      Arg5_type, Arg6_type, Arg7_type, Arg8_type),
+                         Threading_policy, Allocator_type>;
+
+
+
+/**
+ * Fixed capacity signals:
+ * -----------------------
+ */
+
+/**
+ * @brief   Signal with at most Capacity slots, which is emitted
+ *          without waiting or allocating, for real-time threads.
+ * @details Connection management should be done from other
+ *          threads, see wait_free_threaded.
+ */
+template<unsigned int Capacity,
+         class Signature,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+using fixed_signal = signal_n<Signature, wait_free_threaded<Capacity>, Allocator_type>;
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SIGNAL_N_HPP_INCLUDED
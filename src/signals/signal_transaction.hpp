@@ -0,0 +1,151 @@
+#pragma once
+#ifndef HYDROSIG_SIGNAL_TRANSACTION_HPP_INCLUDED
+#define HYDROSIG_SIGNAL_TRANSACTION_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template runs a transaction on a signal
+ *          for the duration of its lifetime.
+ * @details The signal is locked once, when the transaction is
+ *          constructed. Until it is committed, connections and
+ *          disconnections made on the signal by the same thread
+ *          do not lock it again, and their modifications are
+ *          published together upon commit. Concurrent emissions
+ *          therefore activate either the slots connected before
+ *          the transaction or after it, never a part of its
+ *          modifications. Only wait-free emissions running at
+ *          the moment of the commit skip the slots it removed,
+ *          as upon any disconnection. Emissions of signals which
+ *          are not emitted without locking wait for the
+ *          transaction to be committed. The number of slots reported by the
+ *          signal is only updated upon commit as well.
+ *          Transactions on the same signal and thread may be
+ *          nested, only the outermost one locks and commits.
+ *          The signal must not be moved during the transaction,
+ *          and the thread running it must not wait for other
+ *          threads managing the signal.
+ */
+template<class Signal_type>
+class signal_transaction
+{
+public:
+    /**
+     * @brief   Begins a transaction on the given signal.
+     * @param   signal The signal to run the transaction on.
+     * @param   reserve The number of connections expected to be
+     *                  made, for which room is made at once.
+     */
+    explicit signal_transaction(Signal_type &signal, unsigned int reserve = 0);
+
+    /**
+     * @brief   Copy constructing a signal_transaction is disallowed.
+     */
+    signal_transaction(const signal_transaction& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a signal_transaction is disallowed.
+     */
+    signal_transaction& operator=(const signal_transaction& /*src*/) = delete;
+
+    /**
+     * @brief   Commits the transaction, if it was not yet committed.
+     * @details Exceptions thrown while publishing are swallowed, the
+     *          modifications are then published by the next one.
+     */
+    ~signal_transaction();
+
+    /**
+     * @brief   Publishes the modifications made during the
+     *          transaction, and unlocks the signal.
+     * @details Does nothing if the transaction is already
+     *          committed, or nested in another one.
+     */
+    void commit();
+
+private:
+    /**< The signal of the transaction */
+    Signal_type& m_signal;
+
+    /**< Whether the transaction is yet to be committed */
+    bool m_active;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Signal_type>
+signal_transaction<Signal_type>::signal_transaction(Signal_type &signal,
+                                                    unsigned int reserve)
+    : m_signal(signal),
+      m_active(false)
+{
+    m_active = m_signal.beginTransaction(reserve);
+}
+
+template<class Signal_type>
+signal_transaction<Signal_type>::~signal_transaction()
+{
+    try {
+        commit();
+    }
+    catch(...)
+    {
+        ;
+    }
+}
+
+template<class Signal_type>
+void signal_transaction<Signal_type>::commit()
+{
+    if(!m_active) return;
+
+    m_active = false;
+    m_signal.endTransaction();
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SIGNAL_TRANSACTION_HPP_INCLUDED
@@ -30,15 +30,13 @@
 #include "src/signals/signal_base/signal_base.h"
 #include "src/wrappers/signal_wrapper.hpp"
 
-#include "src/signals/signal_0.hpp"
-#include "src/signals/signal_1.hpp"
-#include "src/signals/signal_2.hpp"
-#include "src/signals/signal_3.hpp"
-#include "src/signals/signal_4.hpp"
-#include "src/signals/signal_5.hpp"
-#include "src/signals/signal_6.hpp"
-#include "src/signals/signal_7.hpp"
-#include "src/signals/signal_8.hpp"
+#include "src/signals/signal_n.hpp"
+#include "src/signals/signal_transaction.hpp"
+
+// The static signals need C++17
+#ifdef HYDROSIG_CPP17_AVAILABLE
+# include "src/signals/static_signal.hpp"
+#endif
 
 
 #endif // HYDROSIG_SIGNALS_H_INCLUDED
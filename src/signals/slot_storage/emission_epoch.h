@@ -0,0 +1,158 @@
+#pragma once
+#ifndef HYDROSIG_EMISSION_EPOCH_H_INCLUDED
+#define HYDROSIG_EMISSION_EPOCH_H_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#include <atomic>
+#include <thread>
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class implements epoch-based reclamation for
+ *          data published to lock-free emission.
+ * @details Emitters enter the current epoch before reading a
+ *          published pointer, and leave it when they hold their
+ *          own reference to the pointed data. Writers, after
+ *          publishing a new pointer, advance the epoch and wait
+ *          for the emitters of the previous epoch to leave, after
+ *          which the previously published data can be reclaimed.
+ *          Entering and leaving never blocks, an emitter retries
+ *          only if a writer advanced the epoch meanwhile. Writers
+ *          must be serialised by the caller.
+ */
+class emission_epoch
+{
+public:
+    /**
+     * @brief   Constructs an emission_epoch with no
+     *          emitters in it.
+     */
+    emission_epoch();
+
+    /**
+     * @brief   Copy constructing an emission_epoch is disallowed.
+     */
+    emission_epoch(const emission_epoch& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of an emission_epoch is disallowed.
+     */
+    emission_epoch& operator=(const emission_epoch& /*src*/) = delete;
+
+    /**
+     * @brief   Enters the current epoch.
+     * @details Published data read after this call stays valid
+     *          until the returned epoch is left.
+     * @return  The entered epoch, to be passed to leave().
+     */
+    unsigned int enter() const;
+
+    /**
+     * @brief   Leaves an epoch entered by enter().
+     * @param   epoch The epoch to leave.
+     */
+    void leave(unsigned int epoch) const;
+
+    /**
+     * @brief   Advances the epoch, and waits for all emitters
+     *          which might have read previously published data.
+     * @details Must be called after the new data is published,
+     *          and before the previous data is reclaimed.
+     */
+    void synchronise();
+
+private:
+    /**< The current epoch */
+    std::atomic<unsigned int> m_epoch;
+
+    /**< The number of emitters in even and odd epochs */
+    mutable std::atomic<unsigned int> m_emitters[2];
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+inline emission_epoch::emission_epoch()
+    : m_epoch(0)
+{
+    m_emitters[0].store(0);
+    m_emitters[1].store(0);
+}
+
+inline unsigned int emission_epoch::enter() const
+{
+    while(true)
+    {
+        unsigned int epoch = m_epoch.load();
+        m_emitters[epoch & 1].fetch_add(1);
+
+        // A writer may have advanced the epoch before we
+        // were counted in, in which case we might be missed
+        if(m_epoch.load() == epoch) return epoch;
+
+        m_emitters[epoch & 1].fetch_sub(1, std::memory_order_release);
+    }
+}
+
+inline void emission_epoch::leave(unsigned int epoch) const
+{
+    m_emitters[epoch & 1].fetch_sub(1, std::memory_order_release);
+}
+
+inline void emission_epoch::synchronise()
+{
+    unsigned int epoch = m_epoch.load(std::memory_order_relaxed);
+    m_epoch.store(epoch + 1);
+
+    // Emitters only stay for a reference count increment
+    while(m_emitters[epoch & 1].load(std::memory_order_acquire) != 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_EMISSION_EPOCH_H_INCLUDED
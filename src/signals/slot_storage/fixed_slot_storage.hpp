@@ -0,0 +1,856 @@
+#pragma once
+#ifndef HYDROSIG_FIXED_SLOT_STORAGE_HPP_INCLUDED
+#define HYDROSIG_FIXED_SLOT_STORAGE_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HCore/HMemory/HMemory.h
+#else
+# include <memory>
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+
+#include "src/signals/slot_storage/slot_storage.hpp"
+#include "src/threading/threading_policies.h"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template is a table of slots with fixed
+ *          capacity, published by a fixed_slot_storage.
+ * @details The table owns its slots, and counts the emissions
+ *          which have left it. Once it is retired, the number of
+ *          emissions which entered it is recorded as well, and
+ *          the table is released when the two counts are equal.
+ */
+template<class Slot_ptr_type, unsigned int Capacity>
+struct fixed_slot_table
+{
+    /**
+     * @brief   Constructs an empty, unused table.
+     */
+    fixed_slot_table();
+
+    /**< The slots of the table */
+    Slot_ptr_type m_slots[Capacity];
+
+    /**< The number of slots in the table */
+    unsigned int m_count;
+
+    /**< The number of emissions which have left the table */
+    mutable std::atomic<std::uint32_t> m_departed;
+
+    /**< The number of emissions which have entered the table */
+    std::uint32_t m_entered;
+
+    /**< Whether the table is retired, and waits to be released */
+    bool m_retired;
+};
+
+/**
+ * @brief   This class template is a snapshot of the slots of
+ *          a fixed_slot_storage, taken for emission.
+ * @details The snapshot refers to the published table of the
+ *          storage, and leaves it when destroyed. Taking and
+ *          destroying the snapshot takes a single atomic
+ *          increment each, it never waits, allocates or
+ *          changes the reference count of the slots.
+ */
+template<class Table_type>
+class fixed_slot_snapshot
+{
+public:
+    /**< Typedef for the pointer to a slot */
+    typedef typename std::remove_reference<
+                decltype(std::declval<Table_type&>().m_slots[0])>::type
+    slot_ptr;
+
+    /**< Typedef for the iterator of the snapshot */
+    typedef const slot_ptr*
+    const_iterator;
+
+    /**< Typedef for the reverse iterator of the snapshot */
+    typedef std::reverse_iterator<const_iterator>
+    const_reverse_iterator;
+
+    /**
+     * @brief   Constructs a snapshot of an entered table.
+     * @param   table The table entered by the emission.
+     */
+    explicit fixed_slot_snapshot(const Table_type &table);
+
+    /**
+     * @brief   Constructs a snapshot by moving src.
+     * @details src will no longer refer to the table.
+     * @param   src The snapshot to move.
+     */
+    fixed_slot_snapshot(fixed_slot_snapshot &&src);
+
+    /**
+     * @brief   Copy constructing a snapshot is disallowed.
+     */
+    fixed_slot_snapshot(const fixed_slot_snapshot& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a snapshot is disallowed.
+     */
+    fixed_slot_snapshot& operator=(const fixed_slot_snapshot& /*src*/) = delete;
+
+    /**
+     * @brief   Destroys the snapshot, and leaves the table.
+     */
+    ~fixed_slot_snapshot();
+
+    /**
+     * @brief   Returns whether the snapshot holds no slots.
+     * @return  True if there are no slots in the snapshot.
+     */
+    bool empty() const;
+
+    /**
+     * @brief   Returns an iterator to the first slot.
+     * @return  Iterator to the first slot.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief   Returns an iterator past the last slot.
+     * @return  Iterator past the last slot.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief   Returns a reverse iterator to the last slot.
+     * @return  Reverse iterator to the last slot.
+     */
+    const_reverse_iterator rbegin() const;
+
+    /**
+     * @brief   Returns a reverse iterator before the first slot.
+     * @return  Reverse iterator before the first slot.
+     */
+    const_reverse_iterator rend() const;
+
+private:
+    /**< The entered table, nullptr if moved from */
+    const Table_type* m_table;
+
+};
+
+/**
+ * @brief   This class template stores the slots connected to a
+ *          signal in tables of fixed capacity, for wait-free
+ *          emission.
+ * @details Modifying operations build a new table from the
+ *          published one, and publish it with a single atomic
+ *          exchange. Emissions enter the published table with a
+ *          single atomic increment, which is made on the word
+ *          holding the index of the table, so it can not miss a
+ *          concurrent publication. Retired tables are released
+ *          by the modifying operations, once every emission
+ *          which entered them has left. Emission therefore never
+ *          waits, allocates, or releases a slot.
+ *          Modifications must be serialised by the caller, and
+ *          may wait for a table to be released, if emissions
+ *          hold all the others. Removed slots are invalidated,
+ *          so that running emissions skip them, and those still
+ *          being emitted are released by a later modification.
+ *          Connecting more than Capacity slots throws
+ *          std::length_error. The storage itself allocates
+ *          nothing, the allocator is only kept for the slots.
+ *          Modifications made between beginBatch() and endBatch()
+ *          build a single table, which is published when the batch
+ *          ends. The slots removed by the batch are invalidated
+ *          only then, so emissions never see a part of the batch,
+ *          apart from the emissions running at that moment, which
+ *          skip the removed slots as upon any removal.
+ */
+template<class Slot_type,
+         unsigned int Capacity,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+class fixed_slot_storage
+{
+public:
+    /**< Typedef for the pointer to a slot */
+    typedef HYDROSIG_SHARED_PTR_TYPE<Slot_type>
+    slot_ptr;
+
+    /**< Typedef for the array of slots */
+    typedef slot_ptr slot_list[Capacity];
+
+    /**< Typedef for the table of slots */
+    typedef fixed_slot_table<slot_ptr, Capacity>
+    table_type;
+
+    /**< Typedef for the snapshot of the slots */
+    typedef fixed_slot_snapshot<table_type>
+    snapshot_type;
+
+    /**< The number of tables, the published one, one for
+         emissions still running, and one to build */
+    static const unsigned int table_count = 3;
+
+    /**
+     * @brief   Constructs an empty fixed_slot_storage.
+     * @param   allocator The allocator of the slots.
+     */
+    explicit fixed_slot_storage(const Allocator_type &allocator);
+
+    /**
+     * @brief   Destroys the fixed_slot_storage.
+     */
+    ~fixed_slot_storage();
+
+    /**
+     * @brief   Copy constructing a fixed_slot_storage is disallowed.
+     */
+    fixed_slot_storage(const fixed_slot_storage& /*src*/) = delete;
+
+    /**
+     * @brief   Constructs a fixed_slot_storage by moving src.
+     * @details The slots of src are published in this storage,
+     *          and src is cleared. The allocator of src is copied.
+     * @param   src The fixed_slot_storage to move.
+     */
+    fixed_slot_storage(fixed_slot_storage&& src);
+
+    /**
+     * @brief   Copy assignment of a fixed_slot_storage is disallowed.
+     */
+    fixed_slot_storage& operator=(const fixed_slot_storage& /*src*/) = delete;
+
+    /**
+     * @brief   Move assigns src to this fixed_slot_storage.
+     * @details The slots of src are published in this storage,
+     *          and src is cleared. The allocator is not replaced.
+     * @param   src The fixed_slot_storage to move.
+     */
+    fixed_slot_storage& operator=(fixed_slot_storage&& src);
+
+    /**
+     * @brief   Returns the allocator of the slots.
+     * @return  Copy of the allocator.
+     */
+    Allocator_type getAllocator() const;
+
+    /**
+     * @brief   Returns the number of stored slots.
+     * @details May be called without locking, the number is
+     *          read with a single atomic load.
+     * @return  The number of stored slots.
+     */
+    unsigned int size() const;
+
+    /**
+     * @brief   Returns whether no slots are stored.
+     * @details May be called without locking, the number of
+     *          slots is read with a single atomic load.
+     * @return  True if there are no slots stored.
+     */
+    bool empty() const;
+
+    /**
+     * @brief   Returns whether Capacity slots are stored,
+     *          counting the pending batch, if any.
+     * @details Must be called with the signal locked.
+     * @return  True if no more slots can be appended.
+     */
+    bool isFull() const;
+
+    /**
+     * @brief   Removes all stored slots.
+     * @details Snapshots taken before the call are
+     *          not affected.
+     */
+    void clear();
+
+    /**
+     * @brief   Appends a slot to the end of the storage.
+     * @details Throws std::length_error if the storage is full.
+     * @param   slot The slot to append.
+     */
+    void append(const slot_ptr &slot);
+
+    /**
+     * @brief   Removes the slots matching the given predicate.
+     * @details The predicate is called once for each inspected
+     *          slot, and the inspection stops at the first match
+     *          if removeAll is false.
+     * @param   predicate The predicate to match slots with.
+     * @param   removeAll Whether all matching slots should be
+     *                    removed, or only the first match.
+     * @return  The number of removed slots.
+     */
+    template<class Predicate>
+    unsigned int removeIf(Predicate predicate, bool removeAll);
+
+    /**
+     * @brief   Removes the given slot.
+     * @details The published table has to be rewritten anyway,
+     *          therefore this is bounded by the capacity.
+     * @param   slot Pointer to the slot to remove.
+     * @return  True if the slot was found and removed.
+     */
+    bool remove(const Slot_type* slot);
+
+    /**
+     * @brief   Returns a snapshot of the stored slots.
+     * @details May be called without locking, concurrently with
+     *          modifications. Never waits, and never allocates.
+     * @return  The snapshot of the stored slots.
+     */
+    snapshot_type snapshot() const;
+
+    /**
+     * @brief   Begins a batch of modifications.
+     * @details The modifications are not published until
+     *          endBatch() is called.
+     * @param   reserve Unused, the capacity of the tables is fixed.
+     */
+    void beginBatch(unsigned int reserve);
+
+    /**
+     * @brief   Ends the batch of modifications, and publishes
+     *          them together.
+     */
+    void endBatch();
+
+private:
+    /**
+     * @brief   Returns the table to modify.
+     * @details Outside of batches, and upon the first modification
+     *          of a batch, this is an unused table filled with the
+     *          published slots. Later modifications of the batch
+     *          receive the same table.
+     * @return  Reference to the table to modify.
+     */
+    table_type& writable();
+
+    /**
+     * @brief   Publishes a modified table, unless a batch
+     *          is in progress.
+     * @param   table The modified table.
+     */
+    void apply(table_type &table);
+
+    /**
+     * @brief   Releases a table which turned out to be unmodified,
+     *          unless a batch is in progress.
+     * @param   table The unmodified table.
+     */
+    void discard(table_type &table);
+
+    /**
+     * @brief   Returns a table which is neither published nor
+     *          retired, releasing the retired tables first.
+     * @details Waits for emissions to leave a retired table, if
+     *          there is no such table.
+     * @return  Reference to the unused table.
+     */
+    table_type& unusedTable();
+
+    /**
+     * @brief   Publishes a table, and retires the previously
+     *          published one.
+     * @param   table The table to publish.
+     */
+    void publish(table_type &table);
+
+    /**
+     * @brief   Releases the slots of the retired tables which
+     *          all entered emissions have left.
+     */
+    void releaseRetired();
+
+    /**
+     * @brief   Releases the slots of a table, and marks
+     *          it unused.
+     * @param   table The table to release.
+     */
+    static void releaseTable(table_type &table);
+
+    /**< The allocator of the slots */
+    Allocator_type m_allocator;
+
+    /**< The tables of slots */
+    table_type m_tables[table_count];
+
+    /**< The published table in the low bits, and the number of
+         emissions which entered it above them */
+    mutable std::atomic<std::uint64_t> m_published;
+
+    /**< The index of the published table */
+    unsigned int m_current;
+
+    /**< The number of stored slots */
+    std::atomic<unsigned int> m_size;
+
+    /**< The table built by the batch in progress, nullptr if none */
+    table_type* m_pending;
+
+    /**< Whether a batch of modifications is in progress */
+    bool m_batched;
+
+};
+
+/**
+ * @brief   This class template selects the storage of slots
+ *          for the threading policy of a signal.
+ * @details Signals emitting without locking publish their
+ *          slots trough a slot_storage.
+ */
+template<class Slot_type, class Threading_policy, class Allocator_type>
+struct slot_storage_selector
+{
+    /**< Typedef for the storage of slots */
+    typedef slot_storage<Slot_type,
+                         Threading_policy::lock_free_emission,
+                         Allocator_type>
+    type;
+};
+
+/**
+ * @brief   Specialization for wait-free emission, which stores
+ *          the slots in a fixed_slot_storage.
+ */
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+struct slot_storage_selector<Slot_type, wait_free_threaded<Capacity>, Allocator_type>
+{
+    /**< Typedef for the storage of slots */
+    typedef fixed_slot_storage<Slot_type, Capacity, Allocator_type>
+    type;
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Slot_ptr_type, unsigned int Capacity>
+fixed_slot_table<Slot_ptr_type, Capacity>::fixed_slot_table()
+    : m_count(0),
+      m_departed(0),
+      m_entered(0),
+      m_retired(false)
+{
+    ;
+}
+
+template<class Table_type>
+fixed_slot_snapshot<Table_type>::fixed_slot_snapshot(const Table_type &table)
+    : m_table(&table)
+{
+    ;
+}
+
+template<class Table_type>
+fixed_slot_snapshot<Table_type>::fixed_slot_snapshot(fixed_slot_snapshot &&src)
+    : m_table(src.m_table)
+{
+    src.m_table = nullptr;
+}
+
+template<class Table_type>
+fixed_slot_snapshot<Table_type>::~fixed_slot_snapshot()
+{
+    if(m_table == nullptr) return;
+
+    m_table->m_departed.fetch_add(1, std::memory_order_release);
+}
+
+template<class Table_type>
+bool fixed_slot_snapshot<Table_type>::empty() const
+{
+    return (begin() == end());
+}
+
+template<class Table_type>
+typename fixed_slot_snapshot<Table_type>::const_iterator
+fixed_slot_snapshot<Table_type>::begin() const
+{
+    if(m_table == nullptr) return nullptr;
+
+    return m_table->m_slots;
+}
+
+template<class Table_type>
+typename fixed_slot_snapshot<Table_type>::const_iterator
+fixed_slot_snapshot<Table_type>::end() const
+{
+    if(m_table == nullptr) return nullptr;
+
+    return m_table->m_slots + m_table->m_count;
+}
+
+template<class Table_type>
+typename fixed_slot_snapshot<Table_type>::const_reverse_iterator
+fixed_slot_snapshot<Table_type>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template<class Table_type>
+typename fixed_slot_snapshot<Table_type>::const_reverse_iterator
+fixed_slot_snapshot<Table_type>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::fixed_slot_storage(
+        const Allocator_type &allocator)
+    : m_allocator(allocator),
+      m_published(0),
+      m_current(0),
+      m_size(0),
+      m_pending(nullptr),
+      m_batched(false)
+{
+    ;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::~fixed_slot_storage()
+{
+    ;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::fixed_slot_storage(
+        fixed_slot_storage&& src)
+    : fixed_slot_storage(src.m_allocator)
+{
+    *this = std::move(src);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>&
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::operator=(
+        fixed_slot_storage&& src)
+{
+    if(this == &src) return *this;
+
+    table_type &table = unusedTable();
+    const table_type &current = src.m_tables[src.m_current];
+
+    for(unsigned int i = 0; i < current.m_count; ++i)
+    {
+        table.m_slots[i] = current.m_slots[i];
+    }
+
+    table.m_count = current.m_count;
+
+    publish(table);
+
+    // The moved slots stay valid
+    src.publish(src.unusedTable());
+
+    return *this;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+Allocator_type fixed_slot_storage<Slot_type, Capacity, Allocator_type>::getAllocator() const
+{
+    return m_allocator;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+unsigned int fixed_slot_storage<Slot_type, Capacity, Allocator_type>::size() const
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+bool fixed_slot_storage<Slot_type, Capacity, Allocator_type>::empty() const
+{
+    return (size() == 0);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+bool fixed_slot_storage<Slot_type, Capacity, Allocator_type>::isFull() const
+{
+    unsigned int count = (m_pending != nullptr) ? m_pending->m_count : size();
+
+    return (count == Capacity);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::clear()
+{
+    if(m_batched)
+    {
+        releaseTable(writable());
+        return;
+    }
+
+    const table_type &current = m_tables[m_current];
+
+    if(current.m_count == 0) return;
+
+    for(unsigned int i = 0; i < current.m_count; ++i)
+    {
+        current.m_slots[i]->getValidator()->invalidate(false);
+    }
+
+    publish(unusedTable());
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::append(const slot_ptr &slot)
+{
+    if(isFull())
+    {
+        throw std::length_error("Hydrosig: Fixed slot storage is full.");
+    }
+
+    table_type &table = writable();
+
+    table.m_slots[table.m_count++] = slot;
+
+    apply(table);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+template<class Predicate>
+unsigned int fixed_slot_storage<Slot_type, Capacity, Allocator_type>::removeIf(
+        Predicate predicate, bool removeAll)
+{
+    table_type &table = writable();
+    slot_ptr released[Capacity];
+    unsigned int removed = 0;
+    unsigned int kept = 0;
+
+    for(unsigned int i = 0; i < table.m_count; ++i)
+    {
+        if((removed == 0 || removeAll) && predicate(table.m_slots[i]))
+        {
+            // Running emissions skip the slot from now on,
+            // batches invalidate it once they are published
+            if(!m_batched) table.m_slots[i]->getValidator()->invalidate(false);
+
+            released[removed++] = std::move(table.m_slots[i]);
+        }
+        else
+        {
+            if(kept != i) table.m_slots[kept] = std::move(table.m_slots[i]);
+            kept++;
+        }
+    }
+
+    table.m_count = kept;
+
+    if(removed == 0)
+    {
+        discard(table);
+        return 0;
+    }
+
+    apply(table);
+
+    return removed;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+bool fixed_slot_storage<Slot_type, Capacity, Allocator_type>::remove(const Slot_type* slot)
+{
+    return (removeIf([slot](const slot_ptr &stored) -> bool
+    {
+        return stored.get() == slot;
+    }, false) != 0);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+typename fixed_slot_storage<Slot_type, Capacity, Allocator_type>::snapshot_type
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::snapshot() const
+{
+    // Entering and reading the published index is a single step
+    std::uint64_t published = m_published.fetch_add(table_count + 1,
+                                                    std::memory_order_acquire);
+
+    return snapshot_type(m_tables[published % (table_count + 1)]);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::beginBatch(
+        unsigned int /*reserve*/)
+{
+    m_batched = true;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::endBatch()
+{
+    m_batched = false;
+
+    if(m_pending == nullptr) return;
+
+    table_type &table = *m_pending;
+    const table_type &current = m_tables[m_current];
+    m_pending = nullptr;
+
+    // The kept slots precede the appended ones in the same order,
+    // the published slots missing from the table were removed
+    unsigned int kept = 0;
+
+    for(unsigned int i = 0; i < current.m_count; ++i)
+    {
+        if(kept < table.m_count && table.m_slots[kept] == current.m_slots[i])
+        {
+            kept++;
+        }
+        else
+        {
+            current.m_slots[i]->getValidator()->invalidate(false);
+        }
+    }
+
+    publish(table);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+typename fixed_slot_storage<Slot_type, Capacity, Allocator_type>::table_type&
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::writable()
+{
+    if(m_pending != nullptr) return *m_pending;
+
+    table_type &table = unusedTable();
+    const table_type &current = m_tables[m_current];
+
+    for(unsigned int i = 0; i < current.m_count; ++i)
+    {
+        table.m_slots[i] = current.m_slots[i];
+    }
+
+    table.m_count = current.m_count;
+
+    if(m_batched) m_pending = &table;
+
+    return table;
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::apply(table_type &table)
+{
+    if(!m_batched) publish(table);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::discard(table_type &table)
+{
+    if(!m_batched) releaseTable(table);
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+typename fixed_slot_storage<Slot_type, Capacity, Allocator_type>::table_type&
+fixed_slot_storage<Slot_type, Capacity, Allocator_type>::unusedTable()
+{
+    while(true)
+    {
+        releaseRetired();
+
+        for(unsigned int i = 0; i < table_count; ++i)
+        {
+            if(i != m_current && !m_tables[i].m_retired) return m_tables[i];
+        }
+
+        // Emissions are holding every other table
+        std::this_thread::yield();
+    }
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::publish(table_type &table)
+{
+    unsigned int index = static_cast<unsigned int>(&table - m_tables);
+
+    table.m_departed.store(0, std::memory_order_relaxed);
+    m_size.store(table.m_count, std::memory_order_relaxed);
+
+    std::uint64_t retired = m_published.exchange(index, std::memory_order_acq_rel);
+
+    table_type &previous = m_tables[m_current];
+    previous.m_entered = static_cast<std::uint32_t>(retired / (table_count + 1));
+    previous.m_retired = true;
+
+    m_current = index;
+
+    releaseRetired();
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::releaseRetired()
+{
+    for(unsigned int i = 0; i < table_count; ++i)
+    {
+        table_type &table = m_tables[i];
+
+        if(table.m_retired &&
+           table.m_departed.load(std::memory_order_acquire) == table.m_entered)
+        {
+            releaseTable(table);
+        }
+    }
+}
+
+template<class Slot_type, unsigned int Capacity, class Allocator_type>
+void fixed_slot_storage<Slot_type, Capacity, Allocator_type>::releaseTable(table_type &table)
+{
+    slot_ptr released[Capacity];
+
+    for(unsigned int i = 0; i < table.m_count; ++i)
+    {
+        released[i] = std::move(table.m_slots[i]);
+    }
+
+    // The slots are destroyed after the table is unused, so that
+    // their destructors may manage the connections of the signal
+    table.m_count = 0;
+    table.m_retired = false;
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_FIXED_SLOT_STORAGE_HPP_INCLUDED
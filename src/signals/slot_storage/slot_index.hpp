@@ -0,0 +1,305 @@
+#pragma once
+#ifndef HYDROSIG_SLOT_INDEX_HPP_INCLUDED
+#define HYDROSIG_SLOT_INDEX_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HCore/HMemory/HMemory.h
+#else
+# include <memory>
+#endif
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template indexes the slots of a signal
+ *          by the hash of their targets.
+ * @details Free function and bound member function targets can
+ *          be found trough the index without inspecting the other
+ *          slots, so disconnecting them takes time proportional to
+ *          the number of slots with the same target. Slots with
+ *          callable objects as targets are never compared, and are
+ *          not indexed.
+ *          The index is disabled upon construction, and allocates
+ *          nothing until it is enabled. Its nodes are allocated
+ *          trough the allocator of the index.
+ *          Note that the class itself is not synchronised,
+ *          the holder signal is responsible for locking.
+ */
+template<class Slot_type,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+class slot_index
+{
+public:
+    /**
+     * @brief   Constructs a disabled slot_index.
+     * @param   allocator The allocator to use.
+     */
+    explicit slot_index(const Allocator_type &allocator);
+
+    /**
+     * @brief   Returns whether the index is enabled.
+     * @return  True if the index is enabled.
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief   Enables the index.
+     * @details The slots already connected to the signal have
+     *          to be inserted by the holder.
+     */
+    void enable();
+
+    /**
+     * @brief   Disables the index, and releases its nodes.
+     */
+    void disable();
+
+    /**
+     * @brief   Inserts the given slot.
+     * @details Does nothing if the index is disabled, or the
+     *          target of the slot is a callable object.
+     * @param   slot Pointer to the slot.
+     */
+    void insert(Slot_type* slot);
+
+    /**
+     * @brief   Erases the given slot.
+     * @details Does nothing if the index is disabled, or the
+     *          slot is not indexed.
+     * @param   slot Pointer to the slot.
+     */
+    void erase(const Slot_type* slot);
+
+    /**
+     * @brief   Erases all slots, leaving the index enabled.
+     */
+    void clear();
+
+    /**
+     * @brief   Finds the earliest connected slot with the given
+     *          hash, which matches the given predicate.
+     * @param   hash The hash of the target.
+     * @param   predicate The predicate to match slots with.
+     * @return  Pointer to the slot, or nullptr if none matched.
+     */
+    template<class Predicate>
+    Slot_type* find(std::size_t hash, Predicate predicate) const;
+
+    /**
+     * @brief   Erases the slots with the given hash, which match
+     *          the given predicate.
+     * @details The slot is not accessed after the predicate
+     *          returned true, so the predicate may remove it
+     *          from the signal.
+     * @param   hash The hash of the target.
+     * @param   predicate The predicate to match slots with.
+     * @return  The number of erased slots.
+     */
+    template<class Predicate>
+    unsigned int eraseIf(std::size_t hash, Predicate predicate);
+
+private:
+    /**< Typedef for the map of slots, keyed by their hashes */
+    typedef std::unordered_multimap<std::size_t,
+                                    Slot_type*,
+                                    std::hash<std::size_t>,
+                                    std::equal_to<std::size_t>,
+                                    typename std::allocator_traits<Allocator_type>
+                                    ::template rebind_alloc<
+                                    std::pair<const std::size_t, Slot_type*>>>
+    map_type;
+
+    /**
+     * @brief   Holds the map of slots within its shared block.
+     * @details See slot_storage::list_holder for the reasons.
+     */
+    struct map_holder
+    {
+        explicit map_holder(const Allocator_type &allocator)
+            : m_map(0, std::hash<std::size_t>(),
+                    std::equal_to<std::size_t>(), allocator)
+        {
+            ;
+        }
+
+        map_type m_map;  /**< The held map of slots */
+    };
+
+    /**< The allocator of the index */
+    Allocator_type m_allocator;
+
+    /**< The map of slots, nullptr while the index is disabled */
+    HYDROSIG_SHARED_PTR_TYPE<map_holder> m_holder;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Slot_type, class Allocator_type>
+slot_index<Slot_type, Allocator_type>::slot_index(const Allocator_type &allocator)
+    : m_allocator(allocator),
+      m_holder(nullptr)
+{
+    ;
+}
+
+template<class Slot_type, class Allocator_type>
+bool slot_index<Slot_type, Allocator_type>::isEnabled() const
+{
+    return (m_holder != nullptr);
+}
+
+template<class Slot_type, class Allocator_type>
+void slot_index<Slot_type, Allocator_type>::enable()
+{
+    if(m_holder != nullptr) return;
+
+    m_holder = std::allocate_shared<map_holder>(m_allocator, m_allocator);
+}
+
+template<class Slot_type, class Allocator_type>
+void slot_index<Slot_type, Allocator_type>::disable()
+{
+    m_holder.reset();
+}
+
+template<class Slot_type, class Allocator_type>
+void slot_index<Slot_type, Allocator_type>::insert(Slot_type* slot)
+{
+    if(m_holder == nullptr) return;
+
+    std::size_t hash = slot->getDelegate().hash();
+
+    if(hash != 0) m_holder->m_map.emplace(hash, slot);
+}
+
+template<class Slot_type, class Allocator_type>
+void slot_index<Slot_type, Allocator_type>::erase(const Slot_type* slot)
+{
+    if(m_holder == nullptr) return;
+
+    std::size_t hash = slot->getDelegate().hash();
+
+    if(hash == 0) return;
+
+    std::pair<typename map_type::iterator, typename map_type::iterator> range =
+            m_holder->m_map.equal_range(hash);
+
+    for(typename map_type::iterator it = range.first; it != range.second; ++it)
+    {
+        if(it->second == slot)
+        {
+            m_holder->m_map.erase(it);
+            return;
+        }
+    }
+}
+
+template<class Slot_type, class Allocator_type>
+void slot_index<Slot_type, Allocator_type>::clear()
+{
+    if(m_holder != nullptr) m_holder->m_map.clear();
+}
+
+template<class Slot_type, class Allocator_type>
+template<class Predicate>
+Slot_type* slot_index<Slot_type, Allocator_type>::find(std::size_t hash,
+                                                       Predicate predicate) const
+{
+    if(m_holder == nullptr) return nullptr;
+
+    std::pair<typename map_type::const_iterator, typename map_type::const_iterator> range =
+            m_holder->m_map.equal_range(hash);
+
+    Slot_type* found = nullptr;
+
+    for(typename map_type::const_iterator it = range.first; it != range.second; ++it)
+    {
+        // Positions order the slots as they were connected
+        if(found != nullptr && found->getPosition() < it->second->getPosition()) continue;
+
+        if(predicate(*it->second)) found = it->second;
+    }
+
+    return found;
+}
+
+template<class Slot_type, class Allocator_type>
+template<class Predicate>
+unsigned int slot_index<Slot_type, Allocator_type>::eraseIf(std::size_t hash,
+                                                            Predicate predicate)
+{
+    if(m_holder == nullptr) return 0;
+
+    std::pair<typename map_type::iterator, typename map_type::iterator> range =
+            m_holder->m_map.equal_range(hash);
+
+    unsigned int erased = 0;
+    typename map_type::iterator it = range.first;
+
+    while(it != range.second)
+    {
+        if(predicate(*it->second))
+        {
+            it = m_holder->m_map.erase(it);
+            erased++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return erased;
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SLOT_INDEX_HPP_INCLUDED
@@ -0,0 +1,259 @@
+#pragma once
+#ifndef HYDROSIG_SLOT_PUBLISHER_HPP_INCLUDED
+#define HYDROSIG_SLOT_PUBLISHER_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+#include "src/signals/slot_storage/emission_epoch.h"
+
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HCore/HMemory/HMemory.h
+#else
+# include <atomic>
+# include <memory>
+#endif
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template publishes the array of slots
+ *          of a slot_storage to lock-free emission.
+ * @details The array is published trough an atomic pointer,
+ *          which snapshots are taken from without locking. The
+ *          previously published array is reclaimed only after
+ *          the running emissions have taken their reference to
+ *          it. Publishing must be serialised by the caller.
+ *          The pointers to published arrays are allocated
+ *          trough the allocator of the publisher.
+ */
+template<class List_type, bool Lock_free, class Allocator_type>
+class slot_publisher
+{
+public:
+    /**< Typedef for the immutable snapshot of the slots */
+    typedef HYDROSIG_SHARED_PTR_TYPE<const List_type>
+    snapshot_type;
+
+    /**
+     * @brief   Constructs a slot_publisher with nothing published.
+     * @param   allocator The allocator to use.
+     */
+    slot_publisher(const Allocator_type &allocator);
+
+    /**
+     * @brief   Destroys the slot_publisher.
+     */
+    ~slot_publisher();
+
+    /**
+     * @brief   Copy constructing a slot_publisher is disallowed.
+     */
+    slot_publisher(const slot_publisher& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a slot_publisher is disallowed.
+     */
+    slot_publisher& operator=(const slot_publisher& /*src*/) = delete;
+
+    /**
+     * @brief   Publishes an array of slots, and reclaims the
+     *          previously published one.
+     * @param   slots The array of slots to publish.
+     */
+    void publish(const HYDROSIG_SHARED_PTR_TYPE<List_type> &slots);
+
+    /**
+     * @brief   Returns a snapshot of the published array of slots.
+     * @details May be called without locking, concurrently with
+     *          publishing.
+     * @return  The snapshot of the published array of slots.
+     */
+    snapshot_type snapshot(const HYDROSIG_SHARED_PTR_TYPE<List_type>& /*slots*/) const;
+
+private:
+    /**< Typedef for the allocator of published pointers */
+    typedef typename std::allocator_traits<Allocator_type>
+            ::template rebind_alloc<snapshot_type>
+    snapshot_allocator;
+
+    /**< Typedef for the traits of the allocator */
+    typedef std::allocator_traits<snapshot_allocator>
+    snapshot_traits;
+
+    /**
+     * @brief   Destroys and deallocates a published pointer.
+     * @param   published The pointer to destroy, may be nullptr.
+     */
+    void destroy(snapshot_type* published);
+
+    /**< The allocator of published pointers */
+    snapshot_allocator m_allocator;
+
+    /**< The published array of slots */
+    std::atomic<snapshot_type*> m_published;
+
+    /**< The epoch protecting the published array of slots */
+    emission_epoch m_epoch;
+
+};
+
+/**
+ * @brief   This specialization is used by storages which are
+ *          emitted under lock, and publishes nothing.
+ * @details Snapshots are taken from the array of the storage
+ *          directly, therefore it carries no state.
+ */
+template<class List_type, class Allocator_type>
+class slot_publisher<List_type, false, Allocator_type>
+{
+public:
+    /**< Typedef for the immutable snapshot of the slots */
+    typedef HYDROSIG_SHARED_PTR_TYPE<const List_type>
+    snapshot_type;
+
+    /**
+     * @brief   Constructs a slot_publisher, which needs
+     *          no allocator.
+     */
+    slot_publisher(const Allocator_type& /*allocator*/);
+
+    /**
+     * @brief   Does nothing, the array of slots is not published.
+     */
+    void publish(const HYDROSIG_SHARED_PTR_TYPE<List_type>& /*slots*/);
+
+    /**
+     * @brief   Returns a snapshot of the given array of slots.
+     * @param   slots The array of slots of the storage.
+     * @return  The snapshot of the array of slots.
+     */
+    snapshot_type snapshot(const HYDROSIG_SHARED_PTR_TYPE<List_type> &slots) const;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class List_type, bool Lock_free, class Allocator_type>
+slot_publisher<List_type, Lock_free, Allocator_type>::slot_publisher(
+        const Allocator_type &allocator)
+    : m_allocator(allocator)
+{
+    m_published.store(nullptr);
+}
+
+template<class List_type, bool Lock_free, class Allocator_type>
+slot_publisher<List_type, Lock_free, Allocator_type>::~slot_publisher()
+{
+    destroy(m_published.load());
+}
+
+template<class List_type, bool Lock_free, class Allocator_type>
+void slot_publisher<List_type, Lock_free, Allocator_type>::publish(
+        const HYDROSIG_SHARED_PTR_TYPE<List_type> &slots)
+{
+    snapshot_type* published = nullptr;
+
+    if(slots != nullptr)
+    {
+        published = snapshot_traits::allocate(m_allocator, 1);
+        snapshot_traits::construct(m_allocator, published, slots);
+    }
+
+    snapshot_type* retired = m_published.exchange(published);
+
+    if(retired != nullptr)
+    {
+        m_epoch.synchronise();
+        destroy(retired);
+    }
+}
+
+template<class List_type, bool Lock_free, class Allocator_type>
+typename slot_publisher<List_type, Lock_free, Allocator_type>::snapshot_type
+slot_publisher<List_type, Lock_free, Allocator_type>::snapshot(
+        const HYDROSIG_SHARED_PTR_TYPE<List_type>& /*slots*/) const
+{
+    unsigned int epoch = m_epoch.enter();
+
+    snapshot_type* published = m_published.load(std::memory_order_acquire);
+    snapshot_type snapshot((published == nullptr) ? nullptr : *published);
+
+    m_epoch.leave(epoch);
+
+    return snapshot;
+}
+
+template<class List_type, bool Lock_free, class Allocator_type>
+void slot_publisher<List_type, Lock_free, Allocator_type>::destroy(
+        snapshot_type* published)
+{
+    if(published == nullptr) return;
+
+    snapshot_traits::destroy(m_allocator, published);
+    snapshot_traits::deallocate(m_allocator, published, 1);
+}
+
+template<class List_type, class Allocator_type>
+slot_publisher<List_type, false, Allocator_type>::slot_publisher(
+        const Allocator_type& /*allocator*/)
+{
+    ;
+}
+
+template<class List_type, class Allocator_type>
+void slot_publisher<List_type, false, Allocator_type>::publish(
+        const HYDROSIG_SHARED_PTR_TYPE<List_type>& /*slots*/)
+{
+    ;
+}
+
+template<class List_type, class Allocator_type>
+typename slot_publisher<List_type, false, Allocator_type>::snapshot_type
+slot_publisher<List_type, false, Allocator_type>::snapshot(
+        const HYDROSIG_SHARED_PTR_TYPE<List_type> &slots) const
+{
+    return slots;
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SLOT_PUBLISHER_HPP_INCLUDED
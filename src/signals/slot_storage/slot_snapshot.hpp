@@ -0,0 +1,337 @@
+#pragma once
+#ifndef HYDROSIG_SLOT_SNAPSHOT_HPP_INCLUDED
+#define HYDROSIG_SLOT_SNAPSHOT_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HCore/HMemory/HMemory.h
+#else
+# include <iterator>
+# include <memory>
+# include <utility>
+#endif
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template is an immutable snapshot of
+ *          the slots of a slot_storage, taken for emission.
+ * @details The snapshot either shares the heap array of the
+ *          storage, or holds a copy of the slots the storage
+ *          keeps inline, so that taking it never allocates.
+ *          The snapshot may contain tombstones, which are null
+ *          pointers to be skipped.
+ */
+template<class List_type, unsigned int Inline_count>
+class slot_snapshot
+{
+public:
+    /**< Typedef for the pointer to a slot */
+    typedef typename List_type::value_type
+    slot_ptr;
+
+    /**< Typedef for the iterator of the snapshot */
+    typedef const slot_ptr*
+    const_iterator;
+
+    /**< Typedef for the reverse iterator of the snapshot */
+    typedef std::reverse_iterator<const_iterator>
+    const_reverse_iterator;
+
+    /**
+     * @brief   Constructs an empty snapshot.
+     */
+    slot_snapshot();
+
+    /**
+     * @brief   Constructs a snapshot sharing a heap array.
+     * @param   slots The shared array of slots, may be nullptr.
+     */
+    slot_snapshot(HYDROSIG_SHARED_PTR_TYPE<const List_type> slots);
+
+    /**
+     * @brief   Constructs a snapshot by copying the given
+     *          range of inline slots.
+     * @param   first Pointer to the first slot.
+     * @param   count The number of slots, at most Inline_count.
+     */
+    slot_snapshot(const slot_ptr* first, unsigned int count);
+
+    /**
+     * @brief   Returns whether the snapshot holds no slots.
+     * @return  True if there are no slots in the snapshot.
+     */
+    bool empty() const;
+
+    /**
+     * @brief   Returns an iterator to the first slot.
+     * @return  Iterator to the first slot.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief   Returns an iterator past the last slot.
+     * @return  Iterator past the last slot.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief   Returns a reverse iterator to the last slot.
+     * @return  Reverse iterator to the last slot.
+     */
+    const_reverse_iterator rbegin() const;
+
+    /**
+     * @brief   Returns a reverse iterator before the first slot.
+     * @return  Reverse iterator before the first slot.
+     */
+    const_reverse_iterator rend() const;
+
+private:
+    /**< The shared heap array of slots */
+    HYDROSIG_SHARED_PTR_TYPE<const List_type> m_shared;
+
+    /**< The copied inline slots */
+    slot_ptr m_inline[Inline_count];
+
+    /**< The number of copied inline slots */
+    unsigned int m_count;
+
+};
+
+/**
+ * @brief   This specialization is used by storages which keep
+ *          no slots inline, and only shares their heap array.
+ */
+template<class List_type>
+class slot_snapshot<List_type, 0>
+{
+public:
+    /**< Typedef for the pointer to a slot */
+    typedef typename List_type::value_type
+    slot_ptr;
+
+    /**< Typedef for the iterator of the snapshot */
+    typedef const slot_ptr*
+    const_iterator;
+
+    /**< Typedef for the reverse iterator of the snapshot */
+    typedef std::reverse_iterator<const_iterator>
+    const_reverse_iterator;
+
+    /**
+     * @brief   Constructs a snapshot sharing a heap array.
+     * @param   slots The shared array of slots, may be nullptr.
+     */
+    slot_snapshot(HYDROSIG_SHARED_PTR_TYPE<const List_type> slots = nullptr);
+
+    /**
+     * @brief   Constructs an empty snapshot, as no slots
+     *          are kept inline.
+     */
+    slot_snapshot(const slot_ptr* /*first*/, unsigned int /*count*/);
+
+    /**
+     * @brief   Returns whether the snapshot holds no slots.
+     * @return  True if there are no slots in the snapshot.
+     */
+    bool empty() const;
+
+    /**
+     * @brief   Returns an iterator to the first slot.
+     * @return  Iterator to the first slot.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief   Returns an iterator past the last slot.
+     * @return  Iterator past the last slot.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief   Returns a reverse iterator to the last slot.
+     * @return  Reverse iterator to the last slot.
+     */
+    const_reverse_iterator rbegin() const;
+
+    /**
+     * @brief   Returns a reverse iterator before the first slot.
+     * @return  Reverse iterator before the first slot.
+     */
+    const_reverse_iterator rend() const;
+
+private:
+    /**< The shared heap array of slots */
+    HYDROSIG_SHARED_PTR_TYPE<const List_type> m_shared;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class List_type, unsigned int Inline_count>
+slot_snapshot<List_type, Inline_count>::slot_snapshot()
+    : m_shared(nullptr),
+      m_count(0)
+{
+    ;
+}
+
+template<class List_type, unsigned int Inline_count>
+slot_snapshot<List_type, Inline_count>::slot_snapshot(
+        HYDROSIG_SHARED_PTR_TYPE<const List_type> slots)
+    : m_shared(std::move(slots)),
+      m_count(0)
+{
+    ;
+}
+
+template<class List_type, unsigned int Inline_count>
+slot_snapshot<List_type, Inline_count>::slot_snapshot(
+        const slot_ptr* first, unsigned int count)
+    : m_shared(nullptr),
+      m_count(count)
+{
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        m_inline[i] = first[i];
+    }
+}
+
+template<class List_type, unsigned int Inline_count>
+bool slot_snapshot<List_type, Inline_count>::empty() const
+{
+    return (begin() == end());
+}
+
+template<class List_type, unsigned int Inline_count>
+typename slot_snapshot<List_type, Inline_count>::const_iterator
+slot_snapshot<List_type, Inline_count>::begin() const
+{
+    if(m_shared != nullptr) return m_shared->data();
+
+    return m_inline;
+}
+
+template<class List_type, unsigned int Inline_count>
+typename slot_snapshot<List_type, Inline_count>::const_iterator
+slot_snapshot<List_type, Inline_count>::end() const
+{
+    if(m_shared != nullptr) return m_shared->data() + m_shared->size();
+
+    return m_inline + m_count;
+}
+
+template<class List_type, unsigned int Inline_count>
+typename slot_snapshot<List_type, Inline_count>::const_reverse_iterator
+slot_snapshot<List_type, Inline_count>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template<class List_type, unsigned int Inline_count>
+typename slot_snapshot<List_type, Inline_count>::const_reverse_iterator
+slot_snapshot<List_type, Inline_count>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+
+template<class List_type>
+slot_snapshot<List_type, 0>::slot_snapshot(
+        HYDROSIG_SHARED_PTR_TYPE<const List_type> slots)
+    : m_shared(std::move(slots))
+{
+    ;
+}
+
+template<class List_type>
+slot_snapshot<List_type, 0>::slot_snapshot(
+        const slot_ptr* /*first*/, unsigned int /*count*/)
+    : m_shared(nullptr)
+{
+    ;
+}
+
+template<class List_type>
+bool slot_snapshot<List_type, 0>::empty() const
+{
+    return (m_shared == nullptr || m_shared->empty());
+}
+
+template<class List_type>
+typename slot_snapshot<List_type, 0>::const_iterator
+slot_snapshot<List_type, 0>::begin() const
+{
+    if(m_shared == nullptr) return nullptr;
+
+    return m_shared->data();
+}
+
+template<class List_type>
+typename slot_snapshot<List_type, 0>::const_iterator
+slot_snapshot<List_type, 0>::end() const
+{
+    if(m_shared == nullptr) return nullptr;
+
+    return m_shared->data() + m_shared->size();
+}
+
+template<class List_type>
+typename slot_snapshot<List_type, 0>::const_reverse_iterator
+slot_snapshot<List_type, 0>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template<class List_type>
+typename slot_snapshot<List_type, 0>::const_reverse_iterator
+slot_snapshot<List_type, 0>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SLOT_SNAPSHOT_HPP_INCLUDED
@@ -0,0 +1,825 @@
+#pragma once
+#ifndef HYDROSIG_SLOT_STORAGE_HPP_INCLUDED
+#define HYDROSIG_SLOT_STORAGE_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HContainers/HVector/HVector.hpp
+# include ../HCore/HMemory/HMemory.h
+#else
+# include <atomic>
+# include <memory>
+# include <vector>
+#endif
+
+#include "src/signals/slot_storage/slot_publisher.hpp"
+#include "src/signals/slot_storage/slot_snapshot.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class template stores the slots connected
+ *          to a signal, using copy-on-write semantics.
+ * @details The slots are kept in a contiguous array held trough
+ *          a shared pointer, which is handed out as an immutable
+ *          snapshot for emission. Emitting a signal therefore only
+ *          costs a reference count increment, regardless of the
+ *          number of connected slots. Modifying operations work on
+ *          the array in place while it is not shared, and make a
+ *          private copy of it otherwise, so that snapshots being
+ *          emitted are never modified.
+ *          Removed slots are left in the array as tombstones (null
+ *          pointers), which emission skips. Tombstones are compacted
+ *          in a single pass once they outnumber the live slots, or
+ *          when the array has to be copied anyway.
+ *          While no more than inline_count slots are connected,
+ *          they are kept inside the storage itself, without
+ *          tombstones, and snapshots copy them instead of sharing
+ *          an array. The array is only allocated once more slots
+ *          are connected.
+ *          Note that the class itself is not synchronised,
+ *          the holder signal is responsible for locking.
+ *          If Lock_free is true, no slots are kept inline, and
+ *          the array is additionally published to lock-free
+ *          emission by a slot_publisher.
+ *          The published array is always shared, so it is never
+ *          modified in place.
+ *          The arrays of slots, and their shared pointers are
+ *          allocated trough the allocator of the storage.
+ *          Each slot is told its position in the inline slots
+ *          or in the array, so that it can be removed without
+ *          searching for it.
+ *          Modifications made between beginBatch() and endBatch()
+ *          are published together: lock-free emission and the
+ *          number of slots keep showing the slots stored before
+ *          the batch until it ends. Only the first modification
+ *          of a batch copies a shared array, the rest work on
+ *          the copy in place.
+ */
+template<class Slot_type,
+         bool Lock_free = false,
+         class Allocator_type = HYDROSIG_DEFAULT_ALLOCATOR>
+class slot_storage
+{
+public:
+    /**< Typedef for the pointer to a slot */
+    typedef HYDROSIG_SHARED_PTR_TYPE<Slot_type>
+    slot_ptr;
+
+    /**< Typedef for the array of slots */
+    typedef HYDROSIG_VECTOR_TYPE<slot_ptr,
+                                 typename std::allocator_traits<Allocator_type>
+                                 ::template rebind_alloc<slot_ptr>>
+    slot_list;
+
+    /**< The number of slots kept inside the storage */
+    static const unsigned int inline_count = Lock_free ? 0 : HYDROSIG_INLINE_SLOT_COUNT;
+
+    /**< Typedef for the immutable snapshot of the slots */
+    typedef slot_snapshot<slot_list, inline_count>
+    snapshot_type;
+
+    /**
+     * @brief   Constructs an empty slot_storage.
+     * @param   allocator The allocator to use.
+     */
+    explicit slot_storage(const Allocator_type &allocator);
+
+    /**
+     * @brief   Destroys the slot_storage.
+     */
+    ~slot_storage();
+
+    /**
+     * @brief   Copy constructing a slot_storage is disallowed.
+     */
+    slot_storage(const slot_storage& /*src*/) = delete;
+
+    /**
+     * @brief   Constructs a slot_storage by moving src.
+     * @details src will be left empty after the move. The
+     *          allocator of src is copied.
+     * @param   src The slot_storage to move.
+     */
+    slot_storage(slot_storage&& src);
+
+    /**
+     * @brief   Copy assignment of a slot_storage is disallowed.
+     */
+    slot_storage& operator=(const slot_storage& /*src*/) = delete;
+
+    /**
+     * @brief   Move assigns src to this slot_storage.
+     * @details src will be left empty after the move. The
+     *          allocator is not replaced, the moved arrays are
+     *          released trough the allocator of src.
+     * @param   src The slot_storage to move.
+     */
+    slot_storage& operator=(slot_storage&& src);
+
+    /**
+     * @brief   Returns the allocator of the storage.
+     * @return  Copy of the allocator.
+     */
+    Allocator_type getAllocator() const;
+
+    /**
+     * @brief   Returns the number of stored slots.
+     * @details May be called without locking, the number is
+     *          read with a single atomic load.
+     * @return  The number of stored slots.
+     */
+    unsigned int size() const;
+
+    /**
+     * @brief   Returns whether no slots are stored.
+     * @details May be called without locking, the number of
+     *          slots is read with a single atomic load.
+     * @return  True if there are no slots stored.
+     */
+    bool empty() const;
+
+    /**
+     * @brief   Returns whether no more slots can be stored.
+     * @return  Always false, the storage grows as needed.
+     */
+    bool isFull() const;
+
+    /**
+     * @brief   Removes all stored slots.
+     * @details Snapshots taken before the call are
+     *          not affected.
+     */
+    void clear();
+
+    /**
+     * @brief   Appends a slot to the end of the storage.
+     * @param   slot The slot to append.
+     */
+    void append(const slot_ptr &slot);
+
+    /**
+     * @brief   Removes the slots matching the given predicate.
+     * @details The predicate is called once for each inspected
+     *          slot, and the inspection stops at the first match
+     *          if removeAll is false.
+     * @param   predicate The predicate to match slots with.
+     * @param   removeAll Whether all matching slots should be
+     *                    removed, or only the first match.
+     * @return  The number of removed slots.
+     */
+    template<class Predicate>
+    unsigned int removeIf(Predicate predicate, bool removeAll);
+
+    /**
+     * @brief   Removes the given slot.
+     * @details The slot is found by its position, which the
+     *          storage maintains, therefore no slots are inspected.
+     *          Takes constant time, unless the array is shared with
+     *          a snapshot and has to be copied.
+     * @param   slot Pointer to the slot to remove.
+     * @return  True if the slot was found and removed.
+     */
+    bool remove(const Slot_type* slot);
+
+    /**
+     * @brief   Returns an immutable snapshot of the stored slots.
+     * @details The snapshot is shared with the storage until it
+     *          is modified, therefore taking it requires no
+     *          allocation. The snapshot may contain tombstones,
+     *          which are null pointers to be skipped. Returns
+     *          an empty snapshot if no slots are stored, and a
+     *          copy of the inline slots if there are no more
+     *          than inline_count of them. If Lock_free is
+     *          true, this method may be called without locking,
+     *          concurrently with modifications.
+     * @return  The snapshot of the stored slots.
+     */
+    snapshot_type snapshot() const;
+
+    /**
+     * @brief   Begins a batch of modifications.
+     * @details The modifications are not published until
+     *          endBatch() is called.
+     * @param   reserve The number of slots expected to be
+     *                  appended, for which room is made at once.
+     */
+    void beginBatch(unsigned int reserve);
+
+    /**
+     * @brief   Ends the batch of modifications, and publishes
+     *          them together.
+     */
+    void endBatch();
+
+private:
+    /**
+     * @brief   Returns the array of slots for modification.
+     * @details If the slots are kept inline, they are moved to a
+     *          newly allocated array first. If the array is
+     *          currently shared with a snapshot, a private
+     *          copy of it is made first.
+     * @param   reserve The number of slots to make room for.
+     * @return  Reference to the modifiable array of slots.
+     */
+    slot_list& writable(unsigned int reserve = 1);
+
+    /**
+     * @brief   Returns whether the array of slots is shared with
+     *          a snapshot.
+     * @details If it is not, the array may be modified in place.
+     *          Snapshots are taken under the lock of the signal,
+     *          but released without it, by the decrement of the
+     *          reference count, which has release semantics. The
+     *          count is read by use_count() with a relaxed load,
+     *          so an acquire fence follows it: when the last
+     *          snapshot is seen released, the fence makes the
+     *          reads of its emission happen before the in-place
+     *          modification. ThreadSanitizer does not model
+     *          standalone fences, and reports the modification
+     *          as a race with the released emission.
+     * @return  True if the array is shared.
+     */
+    bool isShared() const;
+
+    /**
+     * @brief   Removes the tombstones from the array of slots,
+     *          if they outnumber the live slots.
+     * @details The emptied array is kept for reuse, unless the
+     *          slots can be kept inline.
+     */
+    void compact();
+
+    /**
+     * @brief   Publishes the array of slots to lock-free emission,
+     *          and reclaims the previously published one.
+     * @details Does nothing if Lock_free is false.
+     */
+    void publish();
+
+    /**
+     * @brief   Sets the number of stored slots.
+     * @details The number read without locking is only updated
+     *          outside of batches.
+     * @param   count The number of stored slots.
+     */
+    void setCount(unsigned int count);
+
+    /**
+     * @brief   Allocates an empty array of slots.
+     * @return  Pointer to the array of slots.
+     */
+    HYDROSIG_SHARED_PTR_TYPE<slot_list> allocateList() const;
+
+    /**
+     * @brief   Holds an array of slots within its shared block.
+     * @details Allocators which construct objects with themselves
+     *          appended (like std::pmr::polymorphic_allocator) would
+     *          supply the array with a second allocator, the holder
+     *          is not allocator-aware and receives only one.
+     */
+    struct list_holder
+    {
+        explicit list_holder(const Allocator_type &allocator)
+            : m_list(allocator)
+        {
+            ;
+        }
+
+        slot_list m_list;  /**< The held array of slots */
+    };
+
+    /**< The allocator of the storage */
+    Allocator_type m_allocator;
+
+    /**< The shared array of slots, nullptr while slots are kept inline */
+    HYDROSIG_SHARED_PTR_TYPE<slot_list> m_slots;
+
+    /**< The slots kept inside the storage */
+    slot_ptr m_inline[inline_count > 0 ? inline_count : 1];
+
+    /**< The number of slots kept inside the storage */
+    unsigned int m_inlineCount;
+
+    /**< The number of tombstones in the array of slots */
+    unsigned int m_tombstones;
+
+    /**< The number of live slots */
+    unsigned int m_count;
+
+    /**< The number of live slots, as last published */
+    std::atomic<unsigned int> m_size;
+
+    /**< Whether a batch of modifications is in progress */
+    bool m_batched;
+
+    /**< The publisher of the array of slots */
+    slot_publisher<slot_list, Lock_free, Allocator_type> m_publisher;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+slot_storage<Slot_type, Lock_free, Allocator_type>::slot_storage(
+        const Allocator_type &allocator)
+    : m_allocator(allocator),
+      m_slots(nullptr),
+      m_inlineCount(0),
+      m_tombstones(0),
+      m_count(0),
+      m_size(0),
+      m_batched(false),
+      m_publisher(allocator)
+{
+    ;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+slot_storage<Slot_type, Lock_free, Allocator_type>::~slot_storage()
+{
+    ;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+slot_storage<Slot_type, Lock_free, Allocator_type>::slot_storage(slot_storage&& src)
+    : m_allocator(src.m_allocator),
+      m_slots(std::move(src.m_slots)),
+      m_inlineCount(src.m_inlineCount),
+      m_tombstones(src.m_tombstones),
+      m_count(src.m_count),
+      m_size(src.m_count),
+      m_batched(false),
+      m_publisher(src.m_allocator)
+{
+    for(unsigned int i = 0; i < m_inlineCount; ++i)
+    {
+        m_inline[i] = std::move(src.m_inline[i]);
+    }
+
+    src.m_inlineCount = 0;
+    src.m_tombstones = 0;
+    src.setCount(0);
+
+    publish();
+    src.publish();
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+slot_storage<Slot_type, Lock_free, Allocator_type>& slot_storage<Slot_type, Lock_free, Allocator_type>::operator=(
+        slot_storage&& src)
+{
+    if(this == &src) return *this;
+
+    m_slots = std::move(src.m_slots);
+
+    // Unused inline entries are null, moving all of them
+    // releases the previous inline slots as well
+    for(unsigned int i = 0; i < inline_count; ++i)
+    {
+        m_inline[i] = std::move(src.m_inline[i]);
+    }
+
+    m_inlineCount = src.m_inlineCount;
+    src.m_inlineCount = 0;
+
+    m_tombstones = src.m_tombstones;
+    setCount(src.m_count);
+    src.m_tombstones = 0;
+    src.setCount(0);
+
+    publish();
+    src.publish();
+
+    return *this;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+Allocator_type slot_storage<Slot_type, Lock_free, Allocator_type>::getAllocator() const
+{
+    return m_allocator;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+unsigned int slot_storage<Slot_type, Lock_free, Allocator_type>::size() const
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+bool slot_storage<Slot_type, Lock_free, Allocator_type>::empty() const
+{
+    return (size() == 0);
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+bool slot_storage<Slot_type, Lock_free, Allocator_type>::isFull() const
+{
+    return false;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::clear()
+{
+    m_slots.reset();
+
+    for(unsigned int i = 0; i < m_inlineCount; ++i)
+    {
+        m_inline[i].reset();
+    }
+
+    m_inlineCount = 0;
+    m_tombstones = 0;
+    setCount(0);
+
+    publish();
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::append(const slot_ptr &slot)
+{
+    if(m_slots == nullptr && m_inlineCount < inline_count)
+    {
+        slot->setPosition(m_inlineCount);
+        m_inline[m_inlineCount++] = slot;
+        setCount(m_count + 1);
+        return;
+    }
+
+    slot_list &slots = writable();
+    slot->setPosition(static_cast<unsigned int>(slots.size()));
+    slots.push_back(slot);
+
+    try {
+        publish();
+    }
+    catch(...)
+    {
+        m_slots->pop_back();
+        throw;
+    }
+
+    setCount(m_count + 1);
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+template<class Predicate>
+unsigned int slot_storage<Slot_type, Lock_free, Allocator_type>::removeIf(Predicate predicate,
+                                                          bool removeAll)
+{
+    unsigned int removed = 0;
+
+    if(m_slots == nullptr)
+    {
+        // The slots are kept inline, close the gaps right away
+        unsigned int kept = 0;
+
+        for(unsigned int i = 0; i < m_inlineCount; ++i)
+        {
+            if((removed == 0 || removeAll) && predicate(m_inline[i]))
+            {
+                m_inline[i].reset();
+                removed++;
+            }
+            else
+            {
+                if(kept != i)
+                {
+                    m_inline[kept] = std::move(m_inline[i]);
+                    m_inline[kept]->setPosition(kept);
+                }
+
+                kept++;
+            }
+        }
+
+        m_inlineCount = kept;
+        setCount(m_count - removed);
+
+        return removed;
+    }
+
+    if(isShared())
+    {
+        // The array is being emitted, build a filtered copy
+        HYDROSIG_SHARED_PTR_TYPE<slot_list> filtered =
+                allocateList();
+        filtered->reserve(m_count);
+
+        typename slot_list::const_iterator itBegin(m_slots->begin());
+        typename slot_list::const_iterator itEnd(m_slots->end());
+
+        while(itBegin != itEnd)
+        {
+            if(*itBegin != nullptr)
+            {
+                if((removed == 0 || removeAll) && predicate(*itBegin))
+                {
+                    removed++;
+                }
+                else
+                {
+                    filtered->push_back(*itBegin);
+                }
+            }
+
+            itBegin++;
+        }
+
+        if(removed != 0)
+        {
+            // Only the slots behind removed slots or tombstones have moved
+            for(unsigned int i = 0; i < filtered->size(); ++i)
+            {
+                if((*filtered)[i]->getPosition() != i)
+                {
+                    (*filtered)[i]->setPosition(i);
+                }
+            }
+
+            m_slots = filtered;
+            m_tombstones = 0;
+            setCount(m_count - removed);
+
+            publish();
+        }
+
+        return removed;
+    }
+
+    // The array is not shared, leave tombstones in place
+    typename slot_list::iterator itBegin(m_slots->begin());
+    typename slot_list::iterator itEnd(m_slots->end());
+
+    while(itBegin != itEnd)
+    {
+        if(*itBegin != nullptr && predicate(*itBegin))
+        {
+            itBegin->reset();
+            removed++;
+
+            if(!removeAll) break;
+        }
+
+        itBegin++;
+    }
+
+    m_tombstones += removed;
+    setCount(m_count - removed);
+    compact();
+
+    return removed;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+bool slot_storage<Slot_type, Lock_free, Allocator_type>::remove(const Slot_type* slot)
+{
+    unsigned int position = slot->getPosition();
+
+    if(m_slots == nullptr)
+    {
+        if(position >= m_inlineCount || m_inline[position].get() != slot)
+        {
+            return false;
+        }
+
+        // Close the gap right away
+        for(unsigned int i = position + 1; i < m_inlineCount; ++i)
+        {
+            m_inline[i - 1] = std::move(m_inline[i]);
+            m_inline[i - 1]->setPosition(i - 1);
+        }
+
+        m_inline[--m_inlineCount].reset();
+        setCount(m_count - 1);
+
+        return true;
+    }
+
+    if(position >= m_slots->size() || (*m_slots)[position].get() != slot)
+    {
+        return false;
+    }
+
+    if(isShared())
+    {
+        if(m_tombstones + 1 > m_count - 1)
+        {
+            // Compact while copying
+            return (removeIf([slot](const slot_ptr &stored) -> bool
+            {
+                return stored.get() == slot;
+            }, false) != 0);
+        }
+
+        // The array is being emitted, copy it with a tombstone
+        writable()[position].reset();
+
+        m_tombstones++;
+        setCount(m_count - 1);
+
+        publish();
+
+        return true;
+    }
+
+    // The array is not shared, leave a tombstone in place
+    (*m_slots)[position].reset();
+
+    m_tombstones++;
+    setCount(m_count - 1);
+    compact();
+
+    return true;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+typename slot_storage<Slot_type, Lock_free, Allocator_type>::snapshot_type
+slot_storage<Slot_type, Lock_free, Allocator_type>::snapshot() const
+{
+    if(!Lock_free && m_slots == nullptr)
+    {
+        return snapshot_type(m_inline, m_inlineCount);
+    }
+
+    return snapshot_type(m_publisher.snapshot(m_slots));
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+typename slot_storage<Slot_type, Lock_free, Allocator_type>::slot_list&
+slot_storage<Slot_type, Lock_free, Allocator_type>::writable(unsigned int reserve)
+{
+    if(m_slots == nullptr)
+    {
+        // Move the inline slots to the heap
+        HYDROSIG_SHARED_PTR_TYPE<slot_list> spilled =
+                allocateList();
+        spilled->reserve(2 * m_inlineCount + reserve);
+
+        for(unsigned int i = 0; i < m_inlineCount; ++i)
+        {
+            spilled->push_back(std::move(m_inline[i]));
+        }
+
+        m_slots = spilled;
+        m_inlineCount = 0;
+    }
+    else if(isShared())
+    {
+        // Tombstones are copied too, so the positions stay valid
+        HYDROSIG_SHARED_PTR_TYPE<slot_list> copy =
+                allocateList();
+        copy->reserve(m_slots->size() + reserve);
+        copy->assign(m_slots->begin(), m_slots->end());
+
+        m_slots = copy;
+    }
+    else
+    {
+        // Single appends leave the growth to the array
+        if(reserve > 1) m_slots->reserve(m_slots->size() + reserve);
+    }
+
+    return *m_slots;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+bool slot_storage<Slot_type, Lock_free, Allocator_type>::isShared() const
+{
+    if(m_slots.use_count() > 1) return true;
+
+    // Synchronise with the release of the last snapshot,
+    // before the array is modified in place
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return false;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::compact()
+{
+    if(m_tombstones <= m_count) return;
+
+    if(m_count == 0 && inline_count > 0)
+    {
+        // Go back to keeping the slots inline
+        clear();
+        return;
+    }
+
+    typename slot_list::iterator itBegin(m_slots->begin());
+    typename slot_list::iterator itEnd(m_slots->end());
+    typename slot_list::iterator itLive(m_slots->begin());
+
+    while(itBegin != itEnd)
+    {
+        if(*itBegin != nullptr)
+        {
+            if(itLive != itBegin)
+            {
+                *itLive = std::move(*itBegin);
+                (*itLive)->setPosition(static_cast<unsigned int>(itLive - m_slots->begin()));
+            }
+
+            itLive++;
+        }
+
+        itBegin++;
+    }
+
+    m_slots->erase(itLive, itEnd);
+    m_tombstones = 0;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::beginBatch(unsigned int reserve)
+{
+    // Make room unless the slots can be kept inline
+    if(reserve != 0 && (m_slots != nullptr || m_count + reserve > inline_count))
+    {
+        writable(reserve);
+    }
+
+    m_batched = true;
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::endBatch()
+{
+    m_batched = false;
+
+    m_size.store(m_count, std::memory_order_relaxed);
+    publish();
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::publish()
+{
+    if(m_batched) return;
+
+    m_publisher.publish(m_slots);
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+void slot_storage<Slot_type, Lock_free, Allocator_type>::setCount(unsigned int count)
+{
+    m_count = count;
+
+    if(!m_batched) m_size.store(count, std::memory_order_relaxed);
+}
+
+template<class Slot_type, bool Lock_free, class Allocator_type>
+HYDROSIG_SHARED_PTR_TYPE<typename slot_storage<Slot_type, Lock_free, Allocator_type>::slot_list>
+slot_storage<Slot_type, Lock_free, Allocator_type>::allocateList() const
+{
+    // The array and its elements share the allocator
+    HYDROSIG_SHARED_PTR_TYPE<list_holder> holder =
+            std::allocate_shared<list_holder>(m_allocator, m_allocator);
+
+    return HYDROSIG_SHARED_PTR_TYPE<slot_list>(holder, &holder->m_list);
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SLOT_STORAGE_HPP_INCLUDED
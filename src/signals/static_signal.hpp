@@ -0,0 +1,184 @@
+#pragma once
+#ifndef HYDROSIG_STATIC_SIGNAL_HPP_INCLUDED
+#define HYDROSIG_STATIC_SIGNAL_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_CPP17_AVAILABLE
+
+#include <cstddef>
+#include <utility>
+
+#include "src/signals/signal_base/signal_base.h"
+#include "src/slots/static_slot.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class represents a signal with the given
+ *          signature and a set of slots fixed at compile time.
+ *          Only function signatures are supported, trough
+ *          the specialization below.
+ */
+template<class Signature, class... Slot_types>
+class static_signal;
+
+/**
+ * @brief   This class represents a signal with any number
+ *          of arguments, and a set of slots fixed at compile
+ *          time.
+ * @details The slots are given as empty callable types, like
+ *          static_function, static_method or stateless function
+ *          objects, which are activated in the order they are
+ *          listed. Emission calls them directly, without storage,
+ *          locking or bookkeeping, so that they can be inlined.
+ *          The slots can not be disconnected or blocked. A static
+ *          signal is itself an empty callable, so it can be
+ *          connected to a signal, or listed as the slot of another
+ *          static signal.
+ */
+template<class Return_type, class... Arg_types, class... Slot_types>
+class static_signal<Return_type(Arg_types...), Slot_types...>
+{
+public:
+    /**
+     * @brief   Returns the number of slots.
+     * @return  The number of slots.
+     */
+    static constexpr std::size_t size();
+
+    /**
+     * @brief   Returns whether the signal has no slots.
+     * @return  True if there are no slots.
+     */
+    static constexpr bool empty();
+
+    /**
+     * @brief   Emits the signal.
+     * @details The slots are activated in the order they are
+     *          listed. Arguments taken by value are copied for
+     *          each slot, and moved into the last one.
+     * @param   args The arguments to emit.
+     */
+    static void emit(Arg_types... args);
+
+    /**
+     * @brief   Emits the signal.
+     * @param   args The arguments to emit.
+     */
+    void operator()(Arg_types... args) const;
+
+private:
+    /**
+     * @brief   Activates the slots with the given indices.
+     * @param   args The emitted arguments.
+     */
+    template<std::size_t... Indices>
+    static void activateSlots(std::index_sequence<Indices...>,
+                              Arg_types&... args);
+
+    /**
+     * @brief   Activates a single slot.
+     * @details The last slot takes over the arguments, the
+     *          others receive copies of them.
+     * @param   args The emitted arguments.
+     */
+    template<class Slot_type, bool Last>
+    static void activate(Arg_types&... args);
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Return_type, class... Arg_types, class... Slot_types>
+constexpr std::size_t static_signal<Return_type(Arg_types...), Slot_types...>::size()
+{
+    return sizeof...(Slot_types);
+}
+
+template<class Return_type, class... Arg_types, class... Slot_types>
+constexpr bool static_signal<Return_type(Arg_types...), Slot_types...>::empty()
+{
+    return sizeof...(Slot_types) == 0;
+}
+
+template<class Return_type, class... Arg_types, class... Slot_types>
+void static_signal<Return_type(Arg_types...), Slot_types...>::emit(Arg_types... args)
+{
+    activateSlots(std::index_sequence_for<Slot_types...>(), args...);
+}
+
+template<class Return_type, class... Arg_types, class... Slot_types>
+void static_signal<Return_type(Arg_types...), Slot_types...>::operator()(
+        Arg_types... args) const
+{
+    emit(std::forward<Arg_types>(args)...);
+}
+
+template<class Return_type, class... Arg_types, class... Slot_types>
+template<std::size_t... Indices>
+void static_signal<Return_type(Arg_types...), Slot_types...>::activateSlots(
+        std::index_sequence<Indices...>, Arg_types&... args)
+{
+    (activate<Slot_types, Indices + 1 == sizeof...(Slot_types)>(args...), ...);
+}
+
+template<class Return_type, class... Arg_types, class... Slot_types>
+template<class Slot_type, bool Last>
+void static_signal<Return_type(Arg_types...), Slot_types...>::activate(
+        Arg_types&... args)
+{
+    if constexpr(Last)
+    {
+        Slot_type()(std::forward<Arg_types>(args)...);
+    }
+    else
+    {
+        Slot_type()(signal_base::copyArgument<Arg_types>(args)...);
+    }
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_CPP17_AVAILABLE
+
+#endif // HYDROSIG_STATIC_SIGNAL_HPP_INCLUDED
@@ -0,0 +1,158 @@
+#pragma once
+#ifndef HYDROSIG_ALLOCATED_SLOT_HPP_INCLUDED
+#define HYDROSIG_ALLOCATED_SLOT_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <memory>
+#include <utility>
+
+#include "src/macros.h"
+#include "src/slots/slot_base/slot_base.h"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class represents a slot allocated trough the
+ *          allocator of its signal.
+ * @details Keeps a copy of the allocator, so that the mutex of
+ *          a serialised slot is allocated trough it as well.
+ *          Otherwise behaves as the slot it derives from.
+ */
+template<class Slot_type, class Allocator_type>
+class allocated_slot : public Slot_type
+{
+public:
+    /**
+     * @brief   Constructs an allocated_slot.
+     * @param   allocator The allocator of the signal.
+     * @param   args The arguments of the constructor of Slot_type.
+     */
+    template<class... Args>
+    allocated_slot(const Allocator_type &allocator, Args&&... args);
+
+    /**
+     * @brief   Destroys the allocated_slot, releasing
+     *          its mutex trough the allocator.
+     */
+    virtual ~allocated_slot();
+
+protected:
+    /**
+     * @brief   Allocates the mutex trough the allocator.
+     * @return  Pointer to the allocated mutex.
+     */
+    HYDROSIG_MUTEX_TYPE* createMutex() override;
+
+    /**
+     * @brief   Destroys a mutex allocated by createMutex().
+     * @param   mutex The mutex to destroy.
+     */
+    void destroyMutex(HYDROSIG_MUTEX_TYPE* mutex) override;
+
+private:
+    /**< Typedef for the mutex type */
+    typedef HYDROSIG_MUTEX_TYPE mutex_type;
+
+    /**< Typedef for the allocator of the mutex */
+    typedef typename std::allocator_traits<Allocator_type>
+            ::template rebind_alloc<mutex_type> mutex_allocator;
+
+    /**< Typedef for the traits of the mutex allocator */
+    typedef std::allocator_traits<mutex_allocator> mutex_traits;
+
+    /**< The allocator of the signal */
+    Allocator_type m_allocator;
+
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<class Slot_type, class Allocator_type>
+template<class... Args>
+allocated_slot<Slot_type, Allocator_type>::allocated_slot(
+        const Allocator_type &allocator,
+        Args&&... args)
+    : Slot_type(std::forward<Args>(args)...),
+      m_allocator(allocator)
+{
+    ;
+}
+
+template<class Slot_type, class Allocator_type>
+allocated_slot<Slot_type, Allocator_type>::~allocated_slot()
+{
+    HYDROSIG_MUTEX_TYPE* mutex = this->m_mutex.exchange(nullptr,
+                                                        std::memory_order_relaxed);
+
+    if(mutex != nullptr) destroyMutex(mutex);
+}
+
+template<class Slot_type, class Allocator_type>
+HYDROSIG_MUTEX_TYPE* allocated_slot<Slot_type, Allocator_type>::createMutex()
+{
+    mutex_allocator allocator(m_allocator);
+    mutex_type* mutex = mutex_traits::allocate(allocator, 1);
+
+    try {
+        new(mutex) mutex_type();
+    }
+    catch(...)
+    {
+        mutex_traits::deallocate(allocator, mutex, 1);
+        throw;
+    }
+
+    return mutex;
+}
+
+template<class Slot_type, class Allocator_type>
+void allocated_slot<Slot_type, Allocator_type>::destroyMutex(HYDROSIG_MUTEX_TYPE* mutex)
+{
+    mutex_allocator allocator(m_allocator);
+
+    mutex->~mutex_type();
+    mutex_traits::deallocate(allocator, mutex, 1);
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_ALLOCATED_SLOT_HPP_INCLUDED
@@ -30,6 +30,15 @@
 #include "src/macros.h"
 #include "src/trackable/trackable.h"
 
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HConcurrent/HMutex.h
+# include ../HCore/HMemory/HMemory.h
+#else
+# include <atomic>
+# include <memory>
+# include <mutex>
+#endif
+
 
 HYDROSIG_NAMESPACE_BEGIN
 
@@ -47,16 +56,99 @@ HYDROSIG_NAMESPACE_BEGIN
  *          implements the blocking mechanism for individual
  *          slots, informing the holding signal if it should
  *          skip the activation of the slot upon being emitted.
+ *          The blocking state and the concurrency policy of the
+ *          slot are kept in the packed state of its validator,
+ *          and are applied by activation_guard objects. Only
+ *          serialised slots allocate a mutex, so the slots of
+ *          thread-confined signals carry none.
+ *          The validator is stored inside the slot, so that a slot
+ *          created by make_shared takes a single allocation. It is
+ *          handed out trough shared pointers aliasing the slot,
+ *          and connections only keep weak pointers to it, which
+ *          expire when the signal destroys the slot.
  */
-class slot_base
+class slot_base : public std::enable_shared_from_this<slot_base>
 {
 public:
+    /**
+     * @brief   This class decides whether a slot may be activated,
+     *          and applies its concurrency policy for the duration
+     *          of the activation.
+     * @details The decision is made from a single load of the packed
+     *          state of the slot. Invalid and blocked slots are not
+     *          activated. The activation of a slot with a tracked
+     *          object is counted in flight on its lifetime token,
+     *          which keeps the object from being destroyed until
+     *          the guard is, and slots of destroyed objects are not
+     *          activated. Reentrant slots are not locked at all,
+     *          serialised slots are locked until the guard is
+     *          destroyed, and skip_if_busy slots are not activated
+     *          while another activation of them is in flight.
+     */
+    class activation_guard
+    {
+    public:
+        /**
+         * @brief   Constructs an activation_guard, and locks
+         *          the slot if its concurrency policy requires.
+         * @param   slot The slot to be activated.
+         * @param   mayBeSkipped Whether the activation may be
+         *                       skipped. If false, the slot is
+         *                       activated regardless of its state,
+         *                       and skip_if_busy slots are only
+         *                       marked as busy. Slots of destroyed
+         *                       objects are never activated.
+         */
+        activation_guard(slot_base &slot, bool mayBeSkipped = true);
+
+        /**
+         * @brief   Destroys the activation_guard, and unlocks
+         *          the slot if it was locked.
+         * @details The call in flight on the tracked object,
+         *          if any, is finished.
+         */
+        ~activation_guard();
+
+        /**
+         * @brief   Copy constructing an activation_guard is disallowed.
+         */
+        activation_guard(const activation_guard& /*src*/) = delete;
+
+        /**
+         * @brief   Assignment of an activation_guard is disallowed.
+         */
+        activation_guard& operator=(const activation_guard& /*src*/) = delete;
+
+        /**
+         * @brief   Returns whether the slot may be activated.
+         * @return  False if the activation should be skipped.
+         */
+        bool isActive() const;
+
+    private:
+        /**< The lock held on the slot, if any */
+        std::unique_lock<HYDROSIG_MUTEX_TYPE> m_lock;
+
+        /**< The validator of the in-flight activation, if counted */
+        connection_validator* m_inFlight;
+
+        /**< The record of the call in flight on the tracked object */
+        lifetime_token::in_flight_record m_tracked;
+
+        /**< Whether the slot may be activated */
+        bool m_active;
+
+    };
+
     /**
      * @brief   Constructs a slot_base object.
-     * @details The state of blocking will be
-     *          initialized to false.
+     * @details The state of blocking will be initialized
+     *          to false, and the concurrency policy to
+     *          reentrant.
+     * @param   counter The invalidation counter of the
+     *                  holder signal.
      */
-    slot_base(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator);
+    slot_base(HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> counter);
 
     /**
      * @brief   Destroys the slot_base.
@@ -72,6 +164,8 @@ public:
     /**
      * @brief   Returns a shared pointer to the validator
      *          of the slot.
+     * @details The pointer shares ownership of the slot,
+     *          which must be owned by a shared pointer.
      * @return  Pointer to the slot's validator.
      */
     HYDROSIG_SHARED_PTR_TYPE<connection_validator> getValidator() const;
@@ -96,15 +190,61 @@ public:
      */
     bool isBlocked() const;
 
+    /**
+     * @brief   Returns the concurrency policy of the slot.
+     * @return  The concurrency policy of the slot.
+     */
+    concurrency_policy getConcurrencyPolicy() const;
+
+    /**
+     * @brief   Sets the concurrency policy of the slot.
+     * @details Activations already running are not affected.
+     *          The mutex serialising the activations is
+     *          allocated when the slot is first made serialised.
+     * @param   policy The concurrency policy to set.
+     */
+    void setConcurrencyPolicy(concurrency_policy policy);
+
+    /**
+     * @brief   Returns the position of the slot in the
+     *          storage of its signal.
+     * @details The position is maintained by the storage,
+     *          and may only be read with the signal locked.
+     * @return  The position of the slot.
+     */
+    unsigned int getPosition() const;
+
+    /**
+     * @brief   Sets the position of the slot in the
+     *          storage of its signal.
+     * @details Must be called with the signal locked.
+     * @param   position The position of the slot.
+     */
+    void setPosition(unsigned int position);
+
 protected:
-    /**< The state of blocking */
-    bool m_blocked;
+    /**
+     * @brief   Allocates the mutex serialising the activations.
+     * @details Allocates on the heap, derived classes can
+     *          allocate trough an allocator instead.
+     * @return  Pointer to the allocated mutex.
+     */
+    virtual HYDROSIG_MUTEX_TYPE* createMutex();
+
+    /**
+     * @brief   Destroys a mutex allocated by createMutex().
+     * @param   mutex The mutex to destroy.
+     */
+    virtual void destroyMutex(HYDROSIG_MUTEX_TYPE* mutex);
 
     /**< The connection validator for the slot */
-    HYDROSIG_SHARED_PTR_TYPE<connection_validator> m_validator;
+    connection_validator m_validator;
+
+    /**< The mutex used for serialising activations, nullptr until needed */
+    std::atomic<HYDROSIG_MUTEX_TYPE*> m_mutex;
 
-    /**< The mutex used for synchronisation */
-    HYDROSIG_MUTEX_TYPE m_mutex;
+    /**< The position of the slot in the storage of its signal */
+    unsigned int m_position;
 
 };
 
@@ -116,42 +256,156 @@ protected:
  * -------------------
  */
 
-inline slot_base::slot_base(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator)
-    : m_blocked(false),
-      m_validator(validator)
+inline slot_base::activation_guard::activation_guard(slot_base &slot,
+                                                    bool mayBeSkipped)
+    : m_inFlight(nullptr),
+      m_active(true)
+{
+    connection_validator &validator = slot.m_validator;
+    // Acquired, so that a serialised policy is seen with its mutex
+    unsigned int state = validator.getState(std::memory_order_acquire);
+
+    if(mayBeSkipped && !connection_validator::isActivatable(state))
+    {
+        m_active = false;
+        return;
+    }
+
+    switch(connection_validator::policyOf(state))
+    {
+    case concurrency_policy::reentrant:
+        break;
+
+    case concurrency_policy::serialised:
+    {
+        HYDROSIG_MUTEX_TYPE* mutex = slot.m_mutex.load(std::memory_order_relaxed);
+
+        m_lock = std::unique_lock<HYDROSIG_MUTEX_TYPE>(*mutex);
+        validator.enterActivation();
+        m_inFlight = &validator;
+        break;
+    }
+
+    case concurrency_policy::skip_if_busy:
+        if(mayBeSkipped)
+        {
+            m_active = validator.tryEnterActivation();
+            if(!m_active) return;
+        }
+        else
+        {
+            validator.enterActivation();
+        }
+        m_inFlight = &validator;
+        break;
+    }
+
+    // Entered after locking, so that a serialised activation destroying
+    // the object does not wait for the activations waiting for its lock
+    if(!validator.enterTracked(m_tracked))
+    {
+        m_active = false;
+    }
+}
+
+inline slot_base::activation_guard::~activation_guard()
+{
+    if(m_inFlight != nullptr) m_inFlight->leaveActivation();
+
+    if(m_tracked.m_token != nullptr) m_tracked.m_token->leave(m_tracked);
+}
+
+inline bool slot_base::activation_guard::isActive() const
+{
+    return m_active;
+}
+
+inline slot_base::slot_base(HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> counter)
+    : m_validator(counter),
+      m_mutex(nullptr),
+      m_position(0)
 {
     ;
 }
 
 inline slot_base::~slot_base()
 {
-    m_validator->invalidate();
+    // Derived classes allocating the mutex themselves release it before
+    delete m_mutex.load(std::memory_order_relaxed);
 }
 
 inline HYDROSIG_SHARED_PTR_TYPE<connection_validator>
 slot_base::getValidator() const
 {
-    return m_validator;
+    // Share the ownership of the slot holding the validator
+    return HYDROSIG_SHARED_PTR_TYPE<connection_validator>(
+                shared_from_this(),
+                const_cast<connection_validator*>(&m_validator));
 }
 
 inline bool slot_base::isValid() const
 {
-    return m_validator->isValid();
+    return m_validator.isValid();
 }
 
 inline void slot_base::block(bool shouldBlock)
 {
-    m_blocked = shouldBlock;
+    m_validator.block(shouldBlock);
 }
 
 inline void slot_base::unblock()
 {
-    m_blocked = false;
+    m_validator.block(false);
 }
 
 inline bool slot_base::isBlocked() const
 {
-    return m_blocked;
+    return m_validator.isBlocked();
+}
+
+inline concurrency_policy slot_base::getConcurrencyPolicy() const
+{
+    return m_validator.getConcurrencyPolicy();
+}
+
+inline void slot_base::setConcurrencyPolicy(concurrency_policy policy)
+{
+    if(policy == concurrency_policy::serialised &&
+       m_mutex.load(std::memory_order_acquire) == nullptr)
+    {
+        HYDROSIG_MUTEX_TYPE* mutex = createMutex();
+        HYDROSIG_MUTEX_TYPE* expected = nullptr;
+
+        // Someone else may have allocated it since the check
+        if(!m_mutex.compare_exchange_strong(expected, mutex,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+        {
+            destroyMutex(mutex);
+        }
+    }
+
+    m_validator.setConcurrencyPolicy(policy);
+}
+
+inline HYDROSIG_MUTEX_TYPE* slot_base::createMutex()
+{
+    return new HYDROSIG_MUTEX_TYPE();
+}
+
+inline void slot_base::destroyMutex(HYDROSIG_MUTEX_TYPE* mutex)
+{
+    delete mutex;
+}
+
+inline unsigned int slot_base::getPosition() const
+{
+    return m_position;
+}
+
+inline void slot_base::setPosition(unsigned int position)
+{
+    m_position = position;
 }
 
 
@@ -0,0 +1,167 @@
+#pragma once
+#ifndef HYDROSIG_SLOT_N_HPP_INCLUDED
+#define HYDROSIG_SLOT_N_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <utility>
+
+#include "src/macros.h"
+#include "src/slots/slot_base/slot_base.h"
+#include "src/delegates/delegate_n.hpp"
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class represents a slot with the given
+ *          signature. Only function signatures are
+ *          supported, trough the specialization below.
+ */
+template<class Signature>
+class slot_n;
+
+/**
+ * @brief   This class represents a slot holding a
+ *          delegate which accept any number of arguments.
+ */
+HYDROSIG_TEMPLATE_N_ARG
+class slot_n<HYDROSIG_N_ARG> : public slot_base
+{
+public:
+    /**< Typedef for the delegate type */
+    typedef delegate_n<HYDROSIG_N_ARG>
+    delegate_type;
+
+    /**
+     * @brief   Constructs a slot_n from a delegate.
+     * @param   delegate The delegate to the target of the slot.
+     * @param   counter The invalidation counter of the
+     *                  holder signal.
+     */
+    slot_n(delegate_type&& delegate,
+           HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> counter);
+
+    /**
+     * @brief   Copy constructing a slot is disallowed.
+     */
+    slot_n(const slot_n& /*src*/) = delete;
+
+    /**
+     * @brief   Move constructing a slot is disallowed.
+     */
+    slot_n(slot_n&& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a slot is disallowed.
+     */
+    slot_n& operator=(const slot_n& /*src*/) = delete;
+
+    /**
+     * @brief   Move assignment of a slot is disallowed.
+     */
+    slot_n& operator=(slot_n&& /*src*/) = delete;
+
+    /**
+     * @brief   Destroys the slot_n object.
+     */
+    virtual ~slot_n();
+
+    /**
+     * @brief   Returns the internally stored delegate.
+     * @return  Reference to the delegate.
+     */
+    const delegate_type& getDelegate() const;
+
+    /**
+     * @brief   Activates the internally stored delegate.
+     * @details The concurrency policy of the slot is not applied,
+     *          callers are responsible for using an activation_guard.
+     *          The arguments are forwarded to the target, those
+     *          taken by value are moved into it.
+     * @return  The result of calling the delegate.
+     * @param   args The arguments.
+     */
+    Return_type activate(Arg_types&&... args);
+
+private:
+    /**< The delegate to the encapsulated function */
+    delegate_type m_delegate;
+
+};
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+HYDROSIG_TEMPLATE_N_ARG
+slot_n<HYDROSIG_N_ARG>::slot_n(
+        delegate_type&& delegate,
+        HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> counter)
+    : slot_base(counter),
+      m_delegate(std::move(delegate))
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+slot_n<HYDROSIG_N_ARG>::~slot_n()
+{
+    ;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+const typename slot_n<HYDROSIG_N_ARG>::delegate_type&
+slot_n<HYDROSIG_N_ARG>::getDelegate() const
+{
+    return m_delegate;
+}
+
+HYDROSIG_TEMPLATE_N_ARG
+Return_type slot_n<HYDROSIG_N_ARG>::activate(
+        Arg_types&&... args)
+{
+    try {
+        return m_delegate(std::forward<Arg_types>(args)...);
+    }
+    catch(...)
+    {
+        throw;
+    }
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_SLOT_N_HPP_INCLUDED
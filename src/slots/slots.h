@@ -29,15 +29,13 @@
 
 #include "src/slots/slot_base/slot_base.h"
 
-#include "src/slots/slot_0.hpp"
-#include "src/slots/slot_1.hpp"
-#include "src/slots/slot_2.hpp"
-#include "src/slots/slot_3.hpp"
-#include "src/slots/slot_4.hpp"
-#include "src/slots/slot_5.hpp"
-#include "src/slots/slot_6.hpp"
-#include "src/slots/slot_7.hpp"
-#include "src/slots/slot_8.hpp"
+#include "src/slots/slot_n.hpp"
+#include "src/slots/allocated_slot.hpp"
+
+// The static slots need C++17
+#ifdef HYDROSIG_CPP17_AVAILABLE
+# include "src/slots/static_slot.hpp"
+#endif
 
 
 #endif // HYDROSIG_SLOTS_H_INCLUDED
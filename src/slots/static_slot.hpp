@@ -0,0 +1,111 @@
+#pragma once
+#ifndef HYDROSIG_STATIC_SLOT_HPP_INCLUDED
+#define HYDROSIG_STATIC_SLOT_HPP_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_CPP17_AVAILABLE
+
+#include <utility>
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class represents a slot of a static_signal,
+ *          calling a free function known at compile time.
+ * @details Objects of this class are empty, the call is
+ *          dispatched directly to the function, which is
+ *          therefore visible to the inliner.
+ */
+template<auto Function>
+struct static_function
+{
+    /**
+     * @brief   Calls the function.
+     * @param   args The arguments.
+     * @return  The result of the function.
+     */
+    template<class... Arg_types>
+    decltype(auto) operator()(Arg_types&&... args) const;
+};
+
+/**
+ * @brief   This class represents a slot of a static_signal,
+ *          calling a member function of an object, both
+ *          known at compile time.
+ * @details The object must have static storage duration,
+ *          so that its address is a constant expression.
+ */
+template<auto Object, auto Method>
+struct static_method
+{
+    /**
+     * @brief   Calls the member function on the object.
+     * @param   args The arguments.
+     * @return  The result of the member function.
+     */
+    template<class... Arg_types>
+    decltype(auto) operator()(Arg_types&&... args) const;
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+template<auto Function>
+template<class... Arg_types>
+decltype(auto) static_function<Function>::operator()(Arg_types&&... args) const
+{
+    return Function(std::forward<Arg_types>(args)...);
+}
+
+template<auto Object, auto Method>
+template<class... Arg_types>
+decltype(auto) static_method<Object, Method>::operator()(Arg_types&&... args) const
+{
+    return (Object->*Method)(std::forward<Arg_types>(args)...);
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_CPP17_AVAILABLE
+
+#endif // HYDROSIG_STATIC_SLOT_HPP_INCLUDED
@@ -0,0 +1,614 @@
+#pragma once
+#ifndef HYDROSIG_THREADING_POLICIES_H_INCLUDED
+#define HYDROSIG_THREADING_POLICIES_H_INCLUDED
+
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "src/macros.h"
+
+#ifdef HYDROSIG_HYDROGEN_AVAILABLE
+# include ../HConcurrent/HMutex.h
+#else
+# include <atomic>
+# include <mutex>
+# include <thread>
+#endif
+
+#ifdef HYDROSIG_CPP14_AVAILABLE
+# include <shared_mutex>
+#endif
+
+
+HYDROSIG_NAMESPACE_BEGIN
+
+
+/**
+ * Class declarations:
+ * -------------------
+ */
+
+/**
+ * @brief   This class is a mutex which does nothing.
+ * @details Used by signals which are confined to a single
+ *          thread, so that they carry no synchronisation.
+ */
+class null_mutex
+{
+public:
+    /**
+     * @brief   Does nothing.
+     */
+    void lock();
+
+    /**
+     * @brief   Does nothing.
+     * @return  Always true.
+     */
+    bool try_lock();
+
+    /**
+     * @brief   Does nothing.
+     */
+    void unlock();
+
+};
+
+/**
+ * @brief   This class is a non-recursive mutex which busy-waits
+ *          instead of suspending the waiting thread.
+ * @details Suited for signals whose critical sections only
+ *          take a snapshot or modify the list of slots.
+ */
+class spin_mutex
+{
+public:
+    /**
+     * @brief   Constructs an unlocked spin_mutex.
+     */
+    spin_mutex();
+
+    /**
+     * @brief   Copy constructing a spin_mutex is disallowed.
+     */
+    spin_mutex(const spin_mutex& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a spin_mutex is disallowed.
+     */
+    spin_mutex& operator=(const spin_mutex& /*src*/) = delete;
+
+    /**
+     * @brief   Locks the mutex, spinning until it is available.
+     */
+    void lock();
+
+    /**
+     * @brief   Locks the mutex if it is available.
+     * @return  True if the mutex was locked.
+     */
+    bool try_lock();
+
+    /**
+     * @brief   Unlocks the mutex.
+     */
+    void unlock();
+
+private:
+    /**< The state of the mutex */
+    std::atomic_flag m_locked;
+
+};
+
+/**
+ * @brief   This class is a non-recursive reader/writer mutex
+ *          which busy-waits instead of suspending the waiting
+ *          thread.
+ * @details Any number of threads may hold shared ownership at
+ *          the same time. A thread waiting for exclusive
+ *          ownership stops new threads from taking shared
+ *          ownership, so that writers are not starved.
+ */
+class shared_spin_mutex
+{
+public:
+    /**
+     * @brief   Constructs an unlocked shared_spin_mutex.
+     */
+    shared_spin_mutex();
+
+    /**
+     * @brief   Copy constructing a shared_spin_mutex is disallowed.
+     */
+    shared_spin_mutex(const shared_spin_mutex& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a shared_spin_mutex is disallowed.
+     */
+    shared_spin_mutex& operator=(const shared_spin_mutex& /*src*/) = delete;
+
+    /**
+     * @brief   Takes exclusive ownership of the mutex, spinning
+     *          until every other owner released it.
+     */
+    void lock();
+
+    /**
+     * @brief   Takes exclusive ownership of the mutex if it has
+     *          no owners.
+     * @return  True if the mutex was locked.
+     */
+    bool try_lock();
+
+    /**
+     * @brief   Releases exclusive ownership of the mutex.
+     */
+    void unlock();
+
+    /**
+     * @brief   Takes shared ownership of the mutex, spinning
+     *          while it is owned or awaited exclusively.
+     */
+    void lock_shared();
+
+    /**
+     * @brief   Takes shared ownership of the mutex if it is
+     *          neither owned nor awaited exclusively.
+     * @return  True if the mutex was locked.
+     */
+    bool try_lock_shared();
+
+    /**
+     * @brief   Releases shared ownership of the mutex.
+     */
+    void unlock_shared();
+
+private:
+    /**< Flag of the state marking exclusive ownership */
+    static const unsigned int writer_flag = 1u << 31;
+
+    /**< The exclusive flag and the number of shared owners */
+    std::atomic<unsigned int> m_state;
+
+};
+
+/**
+ * @brief   This class holds shared ownership of a mutex
+ *          for the duration of its lifetime.
+ * @details Counterpart of std::unique_lock for shared
+ *          ownership, which is available before C++14.
+ */
+template<class Mutex_type>
+class shared_lock
+{
+public:
+    /**
+     * @brief   Constructs a shared_lock, taking shared
+     *          ownership of the given mutex.
+     * @param   mutex The mutex to lock.
+     */
+    explicit shared_lock(Mutex_type &mutex);
+
+    /**
+     * @brief   Constructs a shared_lock without locking
+     *          the given mutex.
+     * @param   mutex The mutex to lock later.
+     */
+    shared_lock(Mutex_type &mutex, std::defer_lock_t /*tag*/);
+
+    /**
+     * @brief   Copy constructing a shared_lock is disallowed.
+     */
+    shared_lock(const shared_lock& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a shared_lock is disallowed.
+     */
+    shared_lock& operator=(const shared_lock& /*src*/) = delete;
+
+    /**
+     * @brief   Destroys the shared_lock, releasing the mutex
+     *          if it is still owned.
+     */
+    ~shared_lock();
+
+    /**
+     * @brief   Takes shared ownership of the mutex.
+     */
+    void lock();
+
+    /**
+     * @brief   Releases shared ownership of the mutex.
+     */
+    void unlock();
+
+    /**
+     * @brief   Returns whether the mutex is currently owned.
+     * @return  True if the mutex is owned.
+     */
+    bool owns_lock() const;
+
+private:
+    /**< The locked mutex */
+    Mutex_type& m_mutex;
+
+    /**< Whether the mutex is currently owned */
+    bool m_owns;
+
+};
+
+/**
+ * @brief   Threading policy for signals which are only
+ *          used from a single thread.
+ * @details Signals using this policy carry no mutex, and
+ *          connection management and emission do no locking.
+ */
+struct single_threaded
+{
+    /**< Typedef for the mutex type */
+    typedef null_mutex mutex_type;
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef std::unique_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = false;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = false;
+};
+
+/**
+ * @brief   Threading policy for signals which are used from
+ *          multiple threads, synchronised by a recursive mutex.
+ */
+struct mutex_threaded
+{
+    /**< Typedef for the mutex type */
+    typedef HYDROSIG_MUTEX_TYPE mutex_type;
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef std::unique_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = false;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = false;
+};
+
+/**
+ * @brief   Threading policy for signals which are used from
+ *          multiple threads, synchronised by a spin_mutex.
+ * @details The mutex is not recursive, therefore slots must
+ *          not manage the connections of the signal from the
+ *          destructor of their callables.
+ */
+struct spinlock_threaded
+{
+    /**< Typedef for the mutex type */
+    typedef spin_mutex mutex_type;
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef std::unique_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = false;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = false;
+};
+
+/**
+ * @brief   Threading policy for signals which are used from
+ *          multiple threads, synchronised by a shared_spin_mutex.
+ * @details Emissions take shared access to the signal, and do
+ *          not serialise on each other. The mutex is not
+ *          recursive, therefore slots must not manage the
+ *          connections of the signal from the destructor of
+ *          their callables.
+ */
+struct shared_spinlock_threaded
+{
+    /**< Typedef for the mutex type */
+    typedef shared_spin_mutex mutex_type;
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef shared_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = false;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = false;
+};
+
+#ifdef HYDROSIG_CPP14_AVAILABLE
+/**
+ * @brief   Threading policy for signals which are used from
+ *          multiple threads, synchronised by a shared mutex.
+ * @details Emissions take shared access to the signal, and do
+ *          not serialise on each other. Available from C++14.
+ *          The mutex is not recursive, therefore slots must not
+ *          manage the connections of the signal from the
+ *          destructor of their callables.
+ */
+struct shared_mutex_threaded
+{
+    /**< Typedef for the mutex type */
+#ifdef HYDROSIG_CPP17_AVAILABLE
+    typedef std::shared_mutex mutex_type;
+#else
+    typedef std::shared_timed_mutex mutex_type;
+#endif
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef shared_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = false;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = false;
+};
+#endif
+
+/**
+ * @brief   Threading policy for signals which are emitted
+ *          frequently from multiple threads, and connected
+ *          to only rarely.
+ * @details Emission never blocks on other emissions, nor on
+ *          connection management, at the cost of copying the
+ *          connected slots and waiting for running emissions
+ *          to release them on every connection and
+ *          disconnection. Connection management is
+ *          synchronised by a recursive mutex.
+ */
+struct lock_free_threaded
+{
+    /**< Typedef for the mutex type */
+    typedef HYDROSIG_MUTEX_TYPE mutex_type;
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef std::unique_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = true;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = false;
+};
+
+/**
+ * @brief   Threading policy for signals which are emitted from
+ *          real-time threads, and have at most Capacity slots.
+ * @details Emission never waits, allocates, or releases memory,
+ *          it takes a single atomic increment to enter the table
+ *          of slots, and another one to leave it. Connection
+ *          management is synchronised by a recursive mutex, and
+ *          should be done from other threads, as it may wait for
+ *          emissions to leave a table of slots. Invalidated
+ *          slots are not swept upon emission, but by
+ *          removeInvalidated(). Connecting more than Capacity
+ *          slots fails with connection_failure. Note that the
+ *          collected emission mode allocates its list of results.
+ */
+template<unsigned int Capacity>
+struct wait_free_threaded
+{
+    /**< Typedef for the mutex type */
+    typedef HYDROSIG_MUTEX_TYPE mutex_type;
+
+    /**< Typedef for the exclusive lock type */
+    typedef std::unique_lock<mutex_type> lock_type;
+
+    /**< Typedef for the lock type used by emission */
+    typedef std::unique_lock<mutex_type> shared_lock_type;
+
+    /**< Whether emission takes snapshots without locking */
+    static const bool lock_free_emission = true;
+
+    /**< Whether emission never waits, allocates or releases */
+    static const bool wait_free_emission = true;
+
+    /**< The maximum number of connected slots */
+    static const unsigned int capacity = Capacity;
+};
+
+
+
+
+/**
+ * Member definitions:
+ * -------------------
+ */
+
+inline void null_mutex::lock()
+{
+    ;
+}
+
+inline bool null_mutex::try_lock()
+{
+    return true;
+}
+
+inline void null_mutex::unlock()
+{
+    ;
+}
+
+inline spin_mutex::spin_mutex()
+{
+    m_locked.clear();
+}
+
+inline void spin_mutex::lock()
+{
+    while(m_locked.test_and_set(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+inline bool spin_mutex::try_lock()
+{
+    return !m_locked.test_and_set(std::memory_order_acquire);
+}
+
+inline void spin_mutex::unlock()
+{
+    m_locked.clear(std::memory_order_release);
+}
+
+inline shared_spin_mutex::shared_spin_mutex()
+{
+    m_state.store(0);
+}
+
+inline void shared_spin_mutex::lock()
+{
+    // Announce the writer, which stops new readers
+    while(m_state.fetch_or(writer_flag, std::memory_order_acquire) & writer_flag)
+    {
+        std::this_thread::yield();
+    }
+
+    // Wait for the readers to leave
+    while(m_state.load(std::memory_order_acquire) != writer_flag)
+    {
+        std::this_thread::yield();
+    }
+}
+
+inline bool shared_spin_mutex::try_lock()
+{
+    unsigned int expected = 0;
+
+    return m_state.compare_exchange_strong(expected, writer_flag,
+                                           std::memory_order_acquire);
+}
+
+inline void shared_spin_mutex::unlock()
+{
+    m_state.fetch_and(~writer_flag, std::memory_order_release);
+}
+
+inline void shared_spin_mutex::lock_shared()
+{
+    while(!try_lock_shared())
+    {
+        std::this_thread::yield();
+    }
+}
+
+inline bool shared_spin_mutex::try_lock_shared()
+{
+    unsigned int state = m_state.load(std::memory_order_relaxed);
+
+    while(!(state & writer_flag))
+    {
+        if(m_state.compare_exchange_weak(state, state + 1,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void shared_spin_mutex::unlock_shared()
+{
+    m_state.fetch_sub(1, std::memory_order_release);
+}
+
+template<class Mutex_type>
+shared_lock<Mutex_type>::shared_lock(Mutex_type &mutex)
+    : m_mutex(mutex),
+      m_owns(false)
+{
+    m_mutex.lock_shared();
+    m_owns = true;
+}
+
+template<class Mutex_type>
+shared_lock<Mutex_type>::shared_lock(Mutex_type &mutex, std::defer_lock_t /*tag*/)
+    : m_mutex(mutex),
+      m_owns(false)
+{
+    ;
+}
+
+template<class Mutex_type>
+shared_lock<Mutex_type>::~shared_lock()
+{
+    if(m_owns) m_mutex.unlock_shared();
+}
+
+template<class Mutex_type>
+void shared_lock<Mutex_type>::lock()
+{
+    m_mutex.lock_shared();
+    m_owns = true;
+}
+
+template<class Mutex_type>
+void shared_lock<Mutex_type>::unlock()
+{
+    m_mutex.unlock_shared();
+    m_owns = false;
+}
+
+template<class Mutex_type>
+bool shared_lock<Mutex_type>::owns_lock() const
+{
+    return m_owns;
+}
+
+
+HYDROSIG_NAMESPACE_END
+
+
+#endif // HYDROSIG_THREADING_POLICIES_H_INCLUDED
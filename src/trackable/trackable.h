@@ -29,14 +29,16 @@
 
 #include "src/macros.h"
 
+#include <cassert>
+#include <type_traits>
+
 #ifdef HYDROSIG_HYDROGEN_AVAILABLE
-# include ../HContainers/HList/HList.hpp
 # include ../HCore/HMemory/HMemory.h
 # include ../HConcurrent/HConcurrent.h
 #else
-# include <list>
+# include <atomic>
 # include <memory>
-# include <mutex>
+# include <thread>
 #endif
 
 
@@ -48,35 +50,303 @@ HYDROSIG_NAMESPACE_BEGIN
  * -------------------
  */
 
+/**
+ * @brief   Counts the connections of a signal which were
+ *          invalidated since the signal last swept them.
+ */
+typedef std::atomic<unsigned int> invalidation_counter;
+
+/**
+ * @brief   This enumeration defines how the activations of a
+ *          slot by concurrent emissions are synchronised.
+ */
+enum class concurrency_policy
+{
+    reentrant,      /**< Activations run concurrently, without locking */
+    serialised,     /**< Activations wait for each other to finish */
+    skip_if_busy    /**< Emissions skip the slot while it is activated */
+};
+
+/**
+ * @brief   This class tells whether a trackable object
+ *          is still alive, and counts the calls in flight
+ *          on it.
+ * @details The token is allocated by the object upon its first
+ *          connection, and shared by the validators of all its
+ *          connections, so that it outlives the object. The
+ *          object expires it when it is destroyed, which
+ *          invalidates every connection to the object at once.
+ *          The alive flag and the number of calls in flight are
+ *          packed into a single atomic word, so entering a call
+ *          checks the flag and counts the call with one atomic
+ *          increment. Expiring the token clears the flag, then
+ *          waits for the calls which entered before it to leave,
+ *          except those entered by the expiring thread itself,
+ *          which could never leave while it waits.
+ */
+class lifetime_token
+{
+public:
+    /**
+     * @brief   Records a call in flight on the stack of the
+     *          calling thread.
+     * @details Records are linked into a thread local list, so
+     *          that expiring a token can tell the calls of its
+     *          own thread apart.
+     */
+    struct in_flight_record
+    {
+        in_flight_record()
+            : m_token(nullptr),
+              m_previous(nullptr)
+        {
+            ;
+        }
+
+        lifetime_token* m_token;        /**< The entered token, nullptr if none */
+        in_flight_record* m_previous;   /**< The record entered before by the thread */
+    };
+
+    /**< Flag of the packed state, set while the object is alive */
+    static const unsigned int alive_flag = 1u << 0;
+
+    /**< One call in flight in the packed state */
+    static const unsigned int in_flight_unit = 1u << 1;
+
+    /**
+     * @brief   Constructs a lifetime_token of an alive object.
+     */
+    lifetime_token();
+
+    /**
+     * @brief   Returns whether the object is alive.
+     * @return  True if the object is not yet destroyed.
+     */
+    bool isAlive() const;
+
+    /**
+     * @brief   Counts a call in flight, unless the object
+     *          is destroyed.
+     * @details Must be paired with a call to leave() with the
+     *          same record, if the call was counted. Records
+     *          must be left in the reverse order of entering.
+     * @param   record The record of the call, kept on the
+     *                 stack of the calling thread.
+     * @return  True if the call was counted.
+     */
+    bool enter(in_flight_record &record);
+
+    /**
+     * @brief   Finishes a call in flight.
+     * @param   record The record passed to enter().
+     */
+    void leave(in_flight_record &record);
+
+    /**
+     * @brief   Marks the object destroyed, and waits for the
+     *          calls in flight on other threads to finish.
+     * @details Calls entering afterwards fail. Calls in flight
+     *          on the expiring thread are not waited for.
+     */
+    void expire();
+
+    /**
+     * @brief   Returns whether calls entered by other threads
+     *          are in flight on the token.
+     * @details The answer may be outdated by the time it is
+     *          returned, it is meant for diagnostics.
+     * @return  True if other threads have calls in flight.
+     */
+    bool isEnteredElsewhere() const;
+
+private:
+    /**
+     * @brief   Returns the innermost record of the calling thread.
+     * @return  Reference to the pointer of the innermost record.
+     */
+    static in_flight_record*& innermostRecord();
+
+    /**
+     * @brief   Returns the number of calls in flight on the
+     *          token, entered by the calling thread.
+     * @return  The number of calls of the calling thread.
+     */
+    unsigned int countOwnRecords() const;
+
+    /**< The packed alive flag and number of calls in flight */
+    std::atomic<unsigned int> m_state;
+
+};
+
 /**
  * @brief   This class can be used to validate a
  *          signal-slot connection.
+ * @details The validator also holds the state of the connection
+ *          read upon every emission, packed into a single atomic
+ *          word: the validity and blocking state, the concurrency
+ *          policy, and the number of in-flight activations of
+ *          non-reentrant slots. Emission decides whether and how
+ *          to activate the slot from a single relaxed load of the
+ *          word, and every state change is a single atomic
+ *          read-modify-write operation.
+ *          Validators of connections to trackable objects refer
+ *          to the lifetime_token of the object, and are invalid
+ *          once it expired.
  */
 class connection_validator
 {
 public:
+    /**< Flag of the packed state, set while the connection is valid */
+    static const unsigned int valid_flag = 1u << 0;
+
+    /**< Flag of the packed state, set while the connection is blocked */
+    static const unsigned int blocked_flag = 1u << 1;
+
+    /**< Position of the concurrency policy in the packed state */
+    static const unsigned int policy_shift = 2;
+
+    /**< Mask of the concurrency policy in the packed state */
+    static const unsigned int policy_mask = 3u << policy_shift;
+
+    /**< One in-flight activation in the packed state */
+    static const unsigned int in_flight_unit = 1u << 4;
+
     /**
      * @brief   Constructs a connection_validator object
      *          in a valid state by default.
      */
     connection_validator();
 
+    /**
+     * @brief   Constructs a connection_validator object
+     *          in a valid state, which notifies the given
+     *          counter when it is invalidated.
+     * @param   counter The invalidation counter of the
+     *                  holder signal.
+     */
+    connection_validator(HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> counter);
+
     /**
      * @brief   Invalidates the connection_validator.
+     * @details The invalidation counter of the holder
+     *          signal is incremented, unless notify is
+     *          false, or the validator was already invalid.
+     * @param   notify Whether the holder signal should
+     *                 be notified.
      */
-    void invalidate();
+    void invalidate(bool notify = true);
 
     /**
      * @brief   Returns whether the connection_validator is
      *          valid.
+     * @details The validator is invalid once its tracked
+     *          object is destroyed.
      * @return  True if the connection_validator is valid,
      *          false otherwise.
      */
     bool isValid() const;
 
+    /**
+     * @brief   Makes the validity of the connection depend on
+     *          the lifetime of a tracked object.
+     * @details Must be called before the connection is emitted.
+     * @param   token The lifetime token of the tracked object.
+     */
+    void track(HYDROSIG_SHARED_PTR_TYPE<lifetime_token> token);
+
+    /**
+     * @brief   Counts a call in flight on the tracked object,
+     *          or invalidates the connection_validator if the
+     *          object is destroyed.
+     * @details The holder signal is notified of the invalidation,
+     *          so that it removes the connection. A counted call
+     *          must be finished by leaving the record on its token.
+     * @param   record The record of the call, kept on the
+     *                 stack of the calling thread.
+     * @return  True if the tracked object is alive, or
+     *          there is none.
+     */
+    bool enterTracked(lifetime_token::in_flight_record &record);
+
+    /**
+     * @brief   Returns the packed state of the connection.
+     * @details The state can be decoded with the flags and
+     *          masks of this class, or the static helper methods.
+     *          Reading it with acquire ordering makes the changes
+     *          made before setting the concurrency policy visible.
+     * @param   order The memory ordering of the load.
+     * @return  The packed state of the connection.
+     */
+    unsigned int getState(std::memory_order order = std::memory_order_relaxed) const;
+
+    /**
+     * @brief   Sets the blocking state of the connection.
+     * @param   shouldBlock The state of blocking to set.
+     */
+    void block(bool shouldBlock = true);
+
+    /**
+     * @brief   Returns whether the connection is blocked.
+     * @return  True if the connection is blocked.
+     */
+    bool isBlocked() const;
+
+    /**
+     * @brief   Returns the concurrency policy of the connection.
+     * @return  The concurrency policy of the connection.
+     */
+    concurrency_policy getConcurrencyPolicy() const;
+
+    /**
+     * @brief   Sets the concurrency policy of the connection.
+     * @param   policy The concurrency policy to set.
+     */
+    void setConcurrencyPolicy(concurrency_policy policy);
+
+    /**
+     * @brief   Counts an activation in flight.
+     * @details Must be paired with a call to leaveActivation().
+     */
+    void enterActivation();
+
+    /**
+     * @brief   Counts an activation in flight, unless
+     *          another activation is already in flight.
+     * @details Must be paired with a call to leaveActivation()
+     *          if the activation was counted.
+     * @return  True if the activation was counted.
+     */
+    bool tryEnterActivation();
+
+    /**
+     * @brief   Finishes an in-flight activation.
+     */
+    void leaveActivation();
+
+    /**
+     * @brief   Returns whether a packed state allows activation,
+     *          that is, the connection is valid and not blocked.
+     * @param   state The packed state to decode.
+     * @return  True if the state allows activation.
+     */
+    static bool isActivatable(unsigned int state);
+
+    /**
+     * @brief   Returns the concurrency policy in a packed state.
+     * @param   state The packed state to decode.
+     * @return  The concurrency policy of the state.
+     */
+    static concurrency_policy policyOf(unsigned int state);
+
 private:
-    /**< The state of validation */
-    bool m_isValid;
+    /**< The packed state of the connection */
+    std::atomic<unsigned int> m_state;
+
+    /**< The invalidation counter of the holder signal */
+    HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> m_counter;
+
+    /**< The lifetime token of the tracked object, nullptr if none */
+    HYDROSIG_SHARED_PTR_TYPE<lifetime_token> m_token;
 
 };
 
@@ -87,46 +357,129 @@ private:
  *          connection validator, or they do not. Trackable objects
  *          that can invalidate their validators, will do so upon
  *          destruction. The status of validation can be checked at
- *          any time. Trackable objects reference their validator
- *          trough a shared_ptr, and it will be deleted automatically
- *          when the last trackable loses track of it.
+ *          any time. Trackable objects share a single lifetime_token
+ *          with the validators of all their connections, which is
+ *          allocated upon the first connection. Connecting to the
+ *          object therefore registers nothing in it, and destroying
+ *          it takes constant time, regardless of the number of its
+ *          connections. Emissions skip the connections of a
+ *          destroyed object, and have their signals remove them
+ *          upon the next sweep. Activations count themselves in
+ *          flight on the token, and destruction waits for those
+ *          already running on other threads, so the object is
+ *          never destroyed under a running call.
+ *          Connections are not copied with the object.
  */
 class trackable
 {
 public:
+    /**
+     * @brief   Constructs a trackable object without connections.
+     */
+    trackable();
+
+    /**
+     * @brief   Copy constructing a trackable is disallowed.
+     */
+    trackable(const trackable& /*src*/) = delete;
+
+    /**
+     * @brief   Assignment of a trackable is disallowed.
+     */
+    trackable& operator=(const trackable& /*src*/) = delete;
+
     /**
      * @brief   Destroys the trackable object.
      * @details The object will invalidate all
-     *          of it's validators.
+     *          of it's validators, by expiring
+     *          its lifetime token.
+     *          See invalidateConnections().
+     *          Debug builds assert that no calls are running
+     *          on other threads, unless the connections were
+     *          already invalidated by a derived class.
      */
     virtual ~trackable();
 
     /**
-     * @brief   Adds a connection validator to the list of
-     *          validators.
-     * @param   validator Pointer to the validator object.
+     * @brief   Returns the lifetime token of the object,
+     *          allocating it upon the first call.
+     * @return  Pointer to the lifetime token.
      */
-    void addValidator(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator);
+    HYDROSIG_SHARED_PTR_TYPE<lifetime_token> getLifetimeToken();
 
     /**
-     * @brief   Removes a connection validator from the list
-     *          of validators.
-     * @param   validator Pointer to the validator object.
+     * @brief   Returns the lifetime token of the object,
+     *          allocating it upon the first call trough the
+     *          given allocator.
+     * @details Signals pass their own allocator, so the token
+     *          is allocated trough the allocator of the first
+     *          signal connecting to the object.
+     * @param   allocator The allocator of the token.
+     * @return  Pointer to the lifetime token.
      */
-    void removeValidator(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator);
+    template<class Allocator_type>
+    HYDROSIG_SHARED_PTR_TYPE<lifetime_token> getLifetimeToken(const Allocator_type &allocator);
 
+protected:
     /**
-     * @brief   Removes all invalidated connection validators
-     *          from the lsit of validators.
+     * @brief   Invalidates all connections to the object, and
+     *          waits for their calls in flight on other threads
+     *          to finish.
+     * @details Called by the destructor of trackable, which runs
+     *          after the destructors of derived classes. Derived
+     *          classes whose slots may be called concurrently
+     *          with their destruction should call it first in
+     *          their destructors, so that no call is left
+     *          running on their destroyed members, or be
+     *          instantiated trough tracked, which does so.
      */
-    void removeInvalidated();
+    void invalidateConnections();
 
 private:
-    /**< Pointer to the list of validators */
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>> m_validators;
+    /**
+     * @brief   Holds the lifetime token within its shared block,
+     *          together with the reference of the object to it.
+     * @details The reference makes the block own itself until the
+     *          object releases it upon destruction, so the token
+     *          takes a single allocation, and is published by a
+     *          single pointer, without locking.
+     */
+    struct token_holder
+    {
+        lifetime_token m_token;                             /**< The held token */
+        HYDROSIG_SHARED_PTR_TYPE<lifetime_token> m_owner;   /**< The reference of the object */
+    };
+
+    /**< The holder of the lifetime token, nullptr until it is allocated */
+    std::atomic<token_holder*> m_holder;
 
-    /**< Mutex used for synchronisation */
-    HYDROSIG_MUTEX_TYPE m_mutex;
+};
+
+/**
+ * @brief   This class completes a class derived from trackable,
+ *          invalidating its connections before any of its
+ *          members are destroyed.
+ * @details The destructor of trackable runs last, after the
+ *          members of derived classes are destroyed. Being the
+ *          most derived class, tracked invalidates the
+ *          connections first instead, and waits for the calls
+ *          running on other threads while the object is still
+ *          intact. Constructed by the constructors of Object.
+ */
+template<class Object>
+class tracked final : public Object
+{
+    static_assert(std::is_base_of<trackable, Object>::value,
+                  "Object must be derived from trackable");
+
+public:
+    using Object::Object;
+
+    /**
+     * @brief   Invalidates the connections of the object,
+     *          then destroys it.
+     */
+    ~tracked() override;
 
 };
 
@@ -138,106 +491,279 @@ private:
  * -------------------
  */
 
-inline connection_validator::connection_validator()
-    : m_isValid(true)
+inline lifetime_token::lifetime_token()
+    : m_state(alive_flag)
 {
     ;
 }
 
-inline void connection_validator::invalidate()
+inline bool lifetime_token::isAlive() const
 {
-    m_isValid = false;
+    return (m_state.load(std::memory_order_relaxed) & alive_flag);
 }
 
-inline bool connection_validator::isValid() const
+inline bool lifetime_token::enter(in_flight_record &record)
 {
-    return m_isValid;
+    unsigned int previous = m_state.fetch_add(in_flight_unit,
+                                              std::memory_order_acquire);
+
+    if(!(previous & alive_flag))
+    {
+        m_state.fetch_sub(in_flight_unit, std::memory_order_relaxed);
+        return false;
+    }
+
+    in_flight_record* &innermost = innermostRecord();
+
+    record.m_token = this;
+    record.m_previous = innermost;
+    innermost = &record;
+
+    return true;
 }
 
-inline trackable::~trackable()
+inline void lifetime_token::leave(in_flight_record &record)
 {
-    removeInvalidated();
+    innermostRecord() = record.m_previous;
+    record.m_token = nullptr;
 
-    HYDROSIG_PROTECTED_BLOCK_BEGIN
+    m_state.fetch_sub(in_flight_unit, std::memory_order_release);
+}
 
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>>
-            ::iterator itBegin(m_validators.begin());
+inline void lifetime_token::expire()
+{
+    m_state.fetch_and(~alive_flag, std::memory_order_acq_rel);
 
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>>
-            ::iterator itEnd(m_validators.end());
+    // Calls entered by this thread up the stack can not leave until it returns
+    unsigned int own = countOwnRecords();
 
-    while(itBegin != itEnd)
+    while((m_state.load(std::memory_order_acquire) / in_flight_unit) > own)
     {
-        (*itBegin)->invalidate();
-        itBegin++;
+        std::this_thread::yield();
     }
+}
 
-    HYDROSIG_PROTECTED_BLOCK_END
+inline bool lifetime_token::isEnteredElsewhere() const
+{
+    return ((m_state.load(std::memory_order_acquire) / in_flight_unit) > countOwnRecords());
 }
 
-inline void trackable::addValidator(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator)
+inline lifetime_token::in_flight_record*& lifetime_token::innermostRecord()
 {
-    removeInvalidated();
+    static thread_local in_flight_record* innermost = nullptr;
 
-    HYDROSIG_PROTECTED_BLOCK_BEGIN
+    return innermost;
+}
 
-    try {
-        m_validators.push_back(validator);
+inline unsigned int lifetime_token::countOwnRecords() const
+{
+    unsigned int count = 0;
+
+    for(const in_flight_record* record = innermostRecord();
+        record != nullptr;
+        record = record->m_previous)
+    {
+        if(record->m_token == this) count++;
     }
-    catch(...)
+
+    return count;
+}
+
+inline connection_validator::connection_validator()
+    : m_state(valid_flag),
+      m_counter(nullptr),
+      m_token(nullptr)
+{
+    ;
+}
+
+inline connection_validator::connection_validator(
+        HYDROSIG_SHARED_PTR_TYPE<invalidation_counter> counter)
+    : m_state(valid_flag),
+      m_counter(counter),
+      m_token(nullptr)
+{
+    ;
+}
+
+inline void connection_validator::invalidate(bool notify)
+{
+    unsigned int previous = m_state.fetch_and(~valid_flag,
+                                              std::memory_order_relaxed);
+
+    if(!(previous & valid_flag)) return;
+
+    if(notify && m_counter != nullptr)
     {
-        throw;
+        m_counter->fetch_add(1, std::memory_order_relaxed);
     }
+}
+
+inline bool connection_validator::isValid() const
+{
+    if(m_token != nullptr && !m_token->isAlive()) return false;
 
-    HYDROSIG_PROTECTED_BLOCK_END
+    return (getState() & valid_flag);
 }
 
-inline void trackable::removeValidator(HYDROSIG_SHARED_PTR_TYPE<connection_validator> validator)
+inline void connection_validator::track(HYDROSIG_SHARED_PTR_TYPE<lifetime_token> token)
 {
-    HYDROSIG_PROTECTED_BLOCK_BEGIN
+    m_token = std::move(token);
+}
 
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>>
-            ::iterator itBegin(m_validators.begin());
+inline bool connection_validator::enterTracked(lifetime_token::in_flight_record &record)
+{
+    if(m_token == nullptr || m_token->enter(record)) return true;
 
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>>
-            ::iterator itEnd(m_validators.end());
+    invalidate();
+    return false;
+}
 
-    while(itBegin != itEnd)
+inline unsigned int connection_validator::getState(std::memory_order order) const
+{
+    return m_state.load(order);
+}
+
+inline void connection_validator::block(bool shouldBlock)
+{
+    if(shouldBlock)
     {
-        if(*itBegin == validator)
-        {
-            m_validators.erase(itBegin);
-            break;
-        }
-        itBegin++;
+        m_state.fetch_or(blocked_flag, std::memory_order_relaxed);
     }
+    else
+    {
+        m_state.fetch_and(~blocked_flag, std::memory_order_relaxed);
+    }
+}
 
-    HYDROSIG_PROTECTED_BLOCK_END
+inline bool connection_validator::isBlocked() const
+{
+    return (getState() & blocked_flag);
+}
+
+inline concurrency_policy connection_validator::getConcurrencyPolicy() const
+{
+    return policyOf(getState());
 }
 
-inline void trackable::removeInvalidated()
+inline void connection_validator::setConcurrencyPolicy(concurrency_policy policy)
 {
-    HYDROSIG_PROTECTED_BLOCK_BEGIN
+    unsigned int state = getState();
+    unsigned int bits = static_cast<unsigned int>(policy) << policy_shift;
 
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>>
-            ::iterator itBegin(m_validators.begin());
+    // Publishes what was prepared for the policy, like the mutex of a slot
+    while(!m_state.compare_exchange_weak(state, (state & ~policy_mask) | bits,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed))
+    {
+        ;
+    }
+}
 
-    HYDROSIG_LIST_TYPE<HYDROSIG_SHARED_PTR_TYPE<connection_validator>>
-            ::iterator itEnd(m_validators.end());
+inline void connection_validator::enterActivation()
+{
+    m_state.fetch_add(in_flight_unit, std::memory_order_acquire);
+}
+
+inline bool connection_validator::tryEnterActivation()
+{
+    unsigned int state = getState();
 
-    while(itBegin != itEnd)
+    while(state < in_flight_unit)
     {
-        if(!(*itBegin)->isValid())
+        if(m_state.compare_exchange_weak(state, state + in_flight_unit,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed))
         {
-            itBegin = m_validators.erase(itBegin);
-            continue;
+            return true;
         }
-        itBegin++;
     }
 
-    HYDROSIG_PROTECTED_BLOCK_END
+    return false;
 }
 
+inline void connection_validator::leaveActivation()
+{
+    m_state.fetch_sub(in_flight_unit, std::memory_order_release);
+}
+
+inline bool connection_validator::isActivatable(unsigned int state)
+{
+    return ((state & (valid_flag | blocked_flag)) == valid_flag);
+}
+
+inline concurrency_policy connection_validator::policyOf(unsigned int state)
+{
+    return static_cast<concurrency_policy>((state & policy_mask) >> policy_shift);
+}
+
+inline trackable::trackable()
+    : m_holder(nullptr)
+{
+    ;
+}
+
+inline trackable::~trackable()
+{
+    token_holder* holder = m_holder.load(std::memory_order_acquire);
+
+    // The members of derived classes are already destroyed under running calls
+    assert((holder == nullptr ||
+            !holder->m_token.isAlive() ||
+            !holder->m_token.isEnteredElsewhere()) &&
+           "Calls are running on a destroyed trackable, see hydrosig::tracked");
+
+    invalidateConnections();
+
+    // The validators keep the token as long as they need it
+    if(holder != nullptr)
+    {
+        HYDROSIG_SHARED_PTR_TYPE<lifetime_token> owner(std::move(holder->m_owner));
+    }
+}
+
+inline HYDROSIG_SHARED_PTR_TYPE<lifetime_token> trackable::getLifetimeToken()
+{
+    return getLifetimeToken(std::allocator<token_holder>());
+}
+
+template<class Allocator_type>
+HYDROSIG_SHARED_PTR_TYPE<lifetime_token> trackable::getLifetimeToken(const Allocator_type &allocator)
+{
+    token_holder* holder = m_holder.load(std::memory_order_acquire);
+
+    if(holder != nullptr) return holder->m_owner;
+
+    HYDROSIG_SHARED_PTR_TYPE<token_holder> allocated =
+            std::allocate_shared<token_holder>(allocator);
+    allocated->m_owner = HYDROSIG_SHARED_PTR_TYPE<lifetime_token>(
+                allocated, &allocated->m_token);
+
+    if(m_holder.compare_exchange_strong(holder, allocated.get(),
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire))
+    {
+        return allocated->m_owner;
+    }
+
+    // Someone else published one since the first check
+    allocated->m_owner.reset();
+
+    return holder->m_owner;
+}
+
+inline void trackable::invalidateConnections()
+{
+    token_holder* holder = m_holder.load(std::memory_order_acquire);
+
+    if(holder != nullptr) holder->m_token.expire();
+}
+
+template<class Object>
+tracked<Object>::~tracked()
+{
+    this->invalidateConnections();
+}
 
 HYDROSIG_NAMESPACE_END
 
@@ -30,15 +30,7 @@
 #include "src/macros.h"
 #include "src/wrappers/wrapper_helpers.h"
 
-#include "src/connections/connection_0.hpp"
-#include "src/connections/connection_1.hpp"
-#include "src/connections/connection_2.hpp"
-#include "src/connections/connection_3.hpp"
-#include "src/connections/connection_4.hpp"
-#include "src/connections/connection_5.hpp"
-#include "src/connections/connection_6.hpp"
-#include "src/connections/connection_7.hpp"
-#include "src/connections/connection_8.hpp"
+#include "src/connections/connection_n.hpp"
 
 
 HYDROSIG_NAMESPACE_BEGIN
@@ -51,128 +43,27 @@ HYDROSIG_NAMESPACE_BEGIN
 
 HYDROSIG_TEMPLATE_PORTABLE_WRAPPER_BASE
 /**
- * @brief   Convenience wrapper for connections with eight arguments.
- * @details Connections with less arguments are specialized types of
- *          this template.
+ * @brief   Convenience wrapper for connections with up to eight arguments.
+ * @details The arguments that are not provided are stripped
+ *          from the signature of the wrapped connection.
  */
 class connection
-        : public connection_8<HYDROSIG_8_ARG>
+        : public connection_n<typename portable_signature<Return_type,
+                                                          Arg1_type, Arg2_type,
+                                                          Arg3_type, Arg4_type,
+                                                          Arg5_type, Arg6_type,
+                                                          Arg7_type, Arg8_type>::type>
 {
 public:
-    connection(const connection_8<HYDROSIG_8_ARG> &src)
-        : connection_8<HYDROSIG_8_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_0_ARG
-/**
- * @brief   Convenience wrapper for connections with zero arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_0_ARG>
-      : public connection_0<HYDROSIG_0_ARG>
-{
-public:
-    connection(const connection_0<HYDROSIG_0_ARG> &src)
-        : connection_0<HYDROSIG_0_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_1_ARG
-/**
- * @brief   Convenience wrapper for connections with one arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_1_ARG>
-      : public connection_1<HYDROSIG_1_ARG>
-{
-public:
-    connection(const connection_1<HYDROSIG_1_ARG> &src)
-        : connection_1<HYDROSIG_1_ARG>(src)
-    {}
-};
+    /**< The signature of the wrapped connection */
+    typedef typename portable_signature<Return_type,
+                                        Arg1_type, Arg2_type,
+                                        Arg3_type, Arg4_type,
+                                        Arg5_type, Arg6_type,
+                                        Arg7_type, Arg8_type>::type signature_type;
 
-HYDROSIG_TEMPLATE_2_ARG
-/**
- * @brief   Convenience wrapper for connections with two arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_2_ARG>
-      : public connection_2<HYDROSIG_2_ARG>
-{
-public:
-    connection(const connection_2<HYDROSIG_2_ARG> &src)
-        : connection_2<HYDROSIG_2_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_3_ARG
-/**
- * @brief   Convenience wrapper for connections with three arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_3_ARG>
-      : public connection_3<HYDROSIG_3_ARG>
-{
-public:
-    connection(const connection_3<HYDROSIG_3_ARG> &src)
-        : connection_3<HYDROSIG_3_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_4_ARG
-/**
- * @brief   Convenience wrapper for connections with four arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_4_ARG>
-      : public connection_4<HYDROSIG_4_ARG>
-{
-public:
-    connection(const connection_4<HYDROSIG_4_ARG> &src)
-        : connection_4<HYDROSIG_4_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_5_ARG
-/**
- * @brief   Convenience wrapper for connections with five arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_5_ARG>
-      : public connection_5<HYDROSIG_5_ARG>
-{
-public:
-    connection(const connection_5<HYDROSIG_5_ARG> &src)
-        : connection_5<HYDROSIG_5_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_6_ARG
-/**
- * @brief   Convenience wrapper for connections with six arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_6_ARG>
-      : public connection_6<HYDROSIG_6_ARG>
-{
-public:
-    connection(const connection_6<HYDROSIG_6_ARG> &src)
-        : connection_6<HYDROSIG_6_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_7_ARG
-/**
- * @brief   Convenience wrapper for connections with seven arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class connection<HYDROSIG_PORTABLE_WRAPPER_7_ARG>
-      : public connection_7<HYDROSIG_7_ARG>
-{
-public:
-    connection(const connection_7<HYDROSIG_7_ARG> &src)
-        : connection_7<HYDROSIG_7_ARG>(src)
+    connection(const connection_n<signature_type> &src)
+        : connection_n<signature_type>(src)
     {}
 };
 
@@ -182,131 +73,20 @@ public:
  * -------------------------------------------------
  */
 
-HYDROSIG_TEMPLATE_0_ARG
-/**
- * @brief   Convenience wrapper for connections with no arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_0_ARG>
-    : public connection_0<HYDROSIG_0_ARG>
-{
-public:
-    connection(const connection_0<HYDROSIG_0_ARG> &src)
-        : connection_0<HYDROSIG_0_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_1_ARG
-/**
- * @brief   Convenience wrapper for connections with one arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_1_ARG>
-    : public connection_1<HYDROSIG_1_ARG>
-{
-public:
-    connection(const connection_1<HYDROSIG_1_ARG> &src)
-        : connection_1<HYDROSIG_1_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_2_ARG
-/**
- * @brief   Convenience wrapper for connections with two arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_2_ARG>
-    : public connection_2<HYDROSIG_2_ARG>
-{
-public:
-    connection(const connection_2<HYDROSIG_2_ARG> &src)
-        : connection_2<HYDROSIG_2_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_3_ARG
+HYDROSIG_TEMPLATE_N_ARG
 /**
- * @brief   Convenience wrapper for connections with three arguments.
+ * @brief   Convenience wrapper for connections with any number of arguments.
  * @details This template version uses the elegant syntax.
  */
-class connection<HYDROSIG_ELEGANT_WRAPPER_3_ARG>
-    : public connection_3<HYDROSIG_3_ARG>
+class connection<HYDROSIG_N_ARG>
+    : public connection_n<HYDROSIG_N_ARG>
 {
 public:
-    connection(const connection_3<HYDROSIG_3_ARG> &src)
-        : connection_3<HYDROSIG_3_ARG>(src)
+    connection(const connection_n<HYDROSIG_N_ARG> &src)
+        : connection_n<HYDROSIG_N_ARG>(src)
     {}
 };
 
-HYDROSIG_TEMPLATE_4_ARG
-/**
- * @brief   Convenience wrapper for connections with four arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_4_ARG>
-    : public connection_4<HYDROSIG_4_ARG>
-{
-public:
-    connection(const connection_4<HYDROSIG_4_ARG> &src)
-        : connection_4<HYDROSIG_4_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_5_ARG
-/**
- * @brief   Convenience wrapper for connections with five arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_5_ARG>
-    : public connection_5<HYDROSIG_5_ARG>
-{
-public:
-    connection(const connection_5<HYDROSIG_5_ARG> &src)
-        : connection_5<HYDROSIG_5_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_6_ARG
-/**
- * @brief   Convenience wrapper for connections with six arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_6_ARG>
-    : public connection_6<HYDROSIG_6_ARG>
-{
-public:
-    connection(const connection_6<HYDROSIG_6_ARG> &src)
-        : connection_6<HYDROSIG_6_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_7_ARG
-/**
- * @brief   Convenience wrapper for connections with seven arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_7_ARG>
-    : public connection_7<HYDROSIG_7_ARG>
-{
-public:
-    connection(const connection_7<HYDROSIG_7_ARG> &src)
-        : connection_7<HYDROSIG_7_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_8_ARG
-/**
- * @brief   Convenience wrapper for connections with eight arguments.
- * @details This template version uses the elegant syntax.
- */
-class connection<HYDROSIG_ELEGANT_WRAPPER_8_ARG>
-    : public connection_8<HYDROSIG_8_ARG>
-{
-public:
-    connection(const connection_8<HYDROSIG_8_ARG> &src)
-        : connection_8<HYDROSIG_8_ARG>(src)
-    {}
-};
 
 /**
  * Convenience scoped_connection wrappers - portable syntax.
@@ -315,259 +95,47 @@ public:
 
 HYDROSIG_TEMPLATE_PORTABLE_WRAPPER_BASE
 /**
- * @brief   Convenience wrapper for scoped_connections with eight arguments.
- * @details Connections with less arguments are specialized types of
- *          this template.
+ * @brief   Convenience wrapper for scoped_connections with up to eight arguments.
+ * @details The arguments that are not provided are stripped
+ *          from the signature of the wrapped connection.
  */
 class scoped_connection
-        : public scoped_connection_8<HYDROSIG_8_ARG>
+        : public scoped_connection_n<typename portable_signature<Return_type,
+                                                                 Arg1_type, Arg2_type,
+                                                                 Arg3_type, Arg4_type,
+                                                                 Arg5_type, Arg6_type,
+                                                                 Arg7_type, Arg8_type>::type>
 {
 public:
-    scoped_connection(const connection_8<HYDROSIG_8_ARG> &src)
-        : scoped_connection_8<HYDROSIG_8_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_0_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with zero arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_0_ARG>
-      : public scoped_connection_0<HYDROSIG_0_ARG>
-{
-public:
-    scoped_connection(const connection_0<HYDROSIG_0_ARG> &src)
-        : scoped_connection_0<HYDROSIG_0_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_1_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with one arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_1_ARG>
-      : public scoped_connection_1<HYDROSIG_1_ARG>
-{
-public:
-    scoped_connection(const connection_1<HYDROSIG_1_ARG> &src)
-        : scoped_connection_1<HYDROSIG_1_ARG>(src)
-    {}
-};
+    /**< The signature of the wrapped connection */
+    typedef typename portable_signature<Return_type,
+                                        Arg1_type, Arg2_type,
+                                        Arg3_type, Arg4_type,
+                                        Arg5_type, Arg6_type,
+                                        Arg7_type, Arg8_type>::type signature_type;
 
-HYDROSIG_TEMPLATE_2_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with two arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_2_ARG>
-      : public scoped_connection_2<HYDROSIG_2_ARG>
-{
-public:
-    scoped_connection(const connection_2<HYDROSIG_2_ARG> &src)
-        : scoped_connection_2<HYDROSIG_2_ARG>(src)
+    scoped_connection(const connection_n<signature_type> &src)
+        : scoped_connection_n<signature_type>(src)
     {}
 };
 
-HYDROSIG_TEMPLATE_3_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with three arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_3_ARG>
-      : public scoped_connection_3<HYDROSIG_3_ARG>
-{
-public:
-    scoped_connection(const connection_3<HYDROSIG_3_ARG> &src)
-        : scoped_connection_3<HYDROSIG_3_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_4_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with four arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_4_ARG>
-      : public scoped_connection_4<HYDROSIG_4_ARG>
-{
-public:
-    scoped_connection(const connection_4<HYDROSIG_4_ARG> &src)
-        : scoped_connection_4<HYDROSIG_4_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_5_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with five arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_5_ARG>
-      : public scoped_connection_5<HYDROSIG_5_ARG>
-{
-public:
-    scoped_connection(const connection_5<HYDROSIG_5_ARG> &src)
-        : scoped_connection_5<HYDROSIG_5_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_6_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with six arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_6_ARG>
-      : public scoped_connection_6<HYDROSIG_6_ARG>
-{
-public:
-    scoped_connection(const connection_6<HYDROSIG_6_ARG> &src)
-        : scoped_connection_6<HYDROSIG_6_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_7_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with seven arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class scoped_connection<HYDROSIG_PORTABLE_WRAPPER_7_ARG>
-      : public scoped_connection_7<HYDROSIG_7_ARG>
-{
-public:
-    scoped_connection(const connection_7<HYDROSIG_7_ARG> &src)
-        : scoped_connection_7<HYDROSIG_7_ARG>(src)
-    {}
-};
 
 /**
  * Convenience scoped_connection wrappers - elegant syntax.
  * --------------------------------------------------------
  */
 
-HYDROSIG_TEMPLATE_0_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with no arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_0_ARG>
-    : public scoped_connection_0<HYDROSIG_0_ARG>
-{
-public:
-    scoped_connection(const connection_0<HYDROSIG_0_ARG> &src)
-        : scoped_connection_0<HYDROSIG_0_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_1_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with one arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_1_ARG>
-    : public scoped_connection_1<HYDROSIG_1_ARG>
-{
-public:
-    scoped_connection(const connection_1<HYDROSIG_1_ARG> &src)
-        : scoped_connection_1<HYDROSIG_1_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_2_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with two arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_2_ARG>
-    : public scoped_connection_2<HYDROSIG_2_ARG>
-{
-public:
-    scoped_connection(const connection_2<HYDROSIG_2_ARG> &src)
-        : scoped_connection_2<HYDROSIG_2_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_3_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with three arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_3_ARG>
-    : public scoped_connection_3<HYDROSIG_3_ARG>
-{
-public:
-    scoped_connection(const connection_3<HYDROSIG_3_ARG> &src)
-        : scoped_connection_3<HYDROSIG_3_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_4_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with four arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_4_ARG>
-    : public scoped_connection_4<HYDROSIG_4_ARG>
-{
-public:
-    scoped_connection(const connection_4<HYDROSIG_4_ARG> &src)
-        : scoped_connection_4<HYDROSIG_4_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_5_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with five arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_5_ARG>
-    : public scoped_connection_5<HYDROSIG_5_ARG>
-{
-public:
-    scoped_connection(const connection_5<HYDROSIG_5_ARG> &src)
-        : scoped_connection_5<HYDROSIG_5_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_6_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with six arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_6_ARG>
-    : public scoped_connection_6<HYDROSIG_6_ARG>
-{
-public:
-    scoped_connection(const connection_6<HYDROSIG_6_ARG> &src)
-        : scoped_connection_6<HYDROSIG_6_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_7_ARG
-/**
- * @brief   Convenience wrapper for scoped_connections with seven arguments.
- * @details This template version uses the elegant syntax.
- */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_7_ARG>
-    : public scoped_connection_7<HYDROSIG_7_ARG>
-{
-public:
-    scoped_connection(const connection_7<HYDROSIG_7_ARG> &src)
-        : scoped_connection_7<HYDROSIG_7_ARG>(src)
-    {}
-};
-
-HYDROSIG_TEMPLATE_8_ARG
+HYDROSIG_TEMPLATE_N_ARG
 /**
- * @brief   Convenience wrapper for connections with eight arguments.
+ * @brief   Convenience wrapper for scoped_connections with any number of arguments.
  * @details This template version uses the elegant syntax.
  */
-class scoped_connection<HYDROSIG_ELEGANT_WRAPPER_8_ARG>
-    : public scoped_connection_8<HYDROSIG_8_ARG>
+class scoped_connection<HYDROSIG_N_ARG>
+    : public scoped_connection_n<HYDROSIG_N_ARG>
 {
 public:
-    scoped_connection(const connection_8<HYDROSIG_8_ARG> &src)
-        : scoped_connection_8<HYDROSIG_8_ARG>(src)
+    scoped_connection(const connection_n<HYDROSIG_N_ARG> &src)
+        : scoped_connection_n<HYDROSIG_N_ARG>(src)
     {}
 };
 
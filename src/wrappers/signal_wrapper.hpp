@@ -30,15 +30,7 @@
 #include "src/macros.h"
 #include "src/wrappers/wrapper_helpers.h"
 
-#include "src/signals/signal_0.hpp"
-#include "src/signals/signal_1.hpp"
-#include "src/signals/signal_2.hpp"
-#include "src/signals/signal_3.hpp"
-#include "src/signals/signal_4.hpp"
-#include "src/signals/signal_5.hpp"
-#include "src/signals/signal_6.hpp"
-#include "src/signals/signal_7.hpp"
-#include "src/signals/signal_8.hpp"
+#include "src/signals/signal_n.hpp"
 
 
 HYDROSIG_NAMESPACE_BEGIN
@@ -51,207 +43,59 @@ HYDROSIG_NAMESPACE_BEGIN
 
 HYDROSIG_TEMPLATE_PORTABLE_WRAPPER_BASE
 /**
- * @brief   Convenience wrapper for signals with eight arguments.
- * @details Signals with less arguments are specialized types of
- *          this template.
+ * @brief   Convenience wrapper for signals with up to eight arguments.
+ * @details The arguments that are not provided are stripped
+ *          from the signature of the wrapped signal.
  */
 class signal
-        : public signal_8<HYDROSIG_8_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_0_ARG
-/**
- * @brief   Convenience wrapper for signals with no arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_0_ARG>
-      : public signal_0<HYDROSIG_0_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_1_ARG
-/**
- * @brief   Convenience wrapper for signals with one arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_1_ARG>
-      : public signal_1<HYDROSIG_1_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_2_ARG
-/**
- * @brief   Convenience wrapper for signals with two arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_2_ARG>
-      : public signal_2<HYDROSIG_2_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_3_ARG
-/**
- * @brief   Convenience wrapper for signals with three arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_3_ARG>
-      : public signal_3<HYDROSIG_3_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_4_ARG
-/**
- * @brief   Convenience wrapper for signals with four arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_4_ARG>
-      : public signal_4<HYDROSIG_4_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_5_ARG
-/**
- * @brief   Convenience wrapper for signals with five arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_5_ARG>
-      : public signal_5<HYDROSIG_5_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_6_ARG
-/**
- * @brief   Convenience wrapper for signals with six arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_6_ARG>
-      : public signal_6<HYDROSIG_6_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_7_ARG
-/**
- * @brief   Convenience wrapper for signals with seven arguments.
- * @details Specialized from the template wrapper for eight arguments.
- */
-class signal<HYDROSIG_PORTABLE_WRAPPER_7_ARG>
-      : public signal_7<HYDROSIG_7_ARG>
+        : public signal_n<typename portable_signature<Return_type,
+                                                      Arg1_type, Arg2_type,
+                                                      Arg3_type, Arg4_type,
+                                                      Arg5_type, Arg6_type,
+                                                      Arg7_type, Arg8_type>::type>
 {
 
 };
 
 
 /**
- * Convenience connection wrappers - elegant syntax.
- * -------------------------------------------------
+ * Convenience signal wrappers - elegant syntax.
+ * ---------------------------------------------
  */
 
-HYDROSIG_TEMPLATE_0_ARG
+HYDROSIG_TEMPLATE_N_ARG
 /**
- * @brief   Convenience wrapper for signals with no arguments.
+ * @brief   Convenience wrapper for signals with any number of arguments.
  * @details This template version uses the elegant syntax.
  */
-class signal<HYDROSIG_ELEGANT_WRAPPER_0_ARG>
-    : public signal_0<HYDROSIG_0_ARG>
+class signal<HYDROSIG_N_ARG>
+    : public signal_n<HYDROSIG_N_ARG>
 {
 
 };
 
-HYDROSIG_TEMPLATE_1_ARG
-/**
- * @brief   Convenience wrapper for signals with one arguments.
- * @details This template version uses the elegant syntax.
- */
-class signal<HYDROSIG_ELEGANT_WRAPPER_1_ARG>
-    : public signal_1<HYDROSIG_1_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_2_ARG
-/**
- * @brief   Convenience wrapper for signals with two arguments.
- * @details This template version uses the elegant syntax.
- */
-class signal<HYDROSIG_ELEGANT_WRAPPER_2_ARG>
-    : public signal_2<HYDROSIG_2_ARG>
-{
-
-};
 
-HYDROSIG_TEMPLATE_3_ARG
 /**
- * @brief   Convenience wrapper for signals with three arguments.
- * @details This template version uses the elegant syntax.
+ * Convenience signal wrappers - elegant syntax with threading policy.
+ * -------------------------------------------------------------------
+ * An allocator may be given after the threading policy.
  */
-class signal<HYDROSIG_ELEGANT_WRAPPER_3_ARG>
-    : public signal_3<HYDROSIG_3_ARG>
-{
 
-};
-
-HYDROSIG_TEMPLATE_4_ARG
+HYDROSIG_SIGNAL_TEMPLATE_N_ARG
 /**
- * @brief   Convenience wrapper for signals with four arguments.
- * @details This template version uses the elegant syntax.
+ * @brief   Convenience wrapper for signals with any number of arguments.
+ * @details This template version uses the elegant syntax,
+ *          and the threading policy and optional allocator
+ *          given after the signature.
  */
-class signal<HYDROSIG_ELEGANT_WRAPPER_4_ARG>
-    : public signal_4<HYDROSIG_4_ARG>
+class signal<HYDROSIG_N_ARG, Threading_policy, Allocator_type>
+    : public signal_n<HYDROSIG_N_ARG, Threading_policy,
+                      typename wrapper_allocator<Allocator_type>::type>
 {
-
-};
-
-HYDROSIG_TEMPLATE_5_ARG
-/**
- * @brief   Convenience wrapper for signals with five arguments.
- * @details This template version uses the elegant syntax.
- */
-class signal<HYDROSIG_ELEGANT_WRAPPER_5_ARG>
-    : public signal_5<HYDROSIG_5_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_6_ARG
-/**
- * @brief   Convenience wrapper for signals with six arguments.
- * @details This template version uses the elegant syntax.
- */
-class signal<HYDROSIG_ELEGANT_WRAPPER_6_ARG>
-    : public signal_6<HYDROSIG_6_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_7_ARG
-/**
- * @brief   Convenience wrapper for signals with seven arguments.
- * @details This template version uses the elegant syntax.
- */
-class signal<HYDROSIG_ELEGANT_WRAPPER_7_ARG>
-    : public signal_7<HYDROSIG_7_ARG>
-{
-
-};
-
-HYDROSIG_TEMPLATE_8_ARG
-/**
- * @brief   Convenience wrapper for signals with eight arguments.
- * @details This template version uses the elegant syntax.
- */
-class signal<HYDROSIG_ELEGANT_WRAPPER_8_ARG>
-    : public signal_8<HYDROSIG_8_ARG>
-{
-
+public:
+    /**< Inherits the constructors taking an allocator */
+    using signal_n<HYDROSIG_N_ARG, Threading_policy,
+                   typename wrapper_allocator<Allocator_type>::type>::signal_n;
 };
 
 
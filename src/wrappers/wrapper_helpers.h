@@ -27,6 +27,8 @@
  *
  */
 
+#include <memory>
+
 #include "src/macros.h"
 
 
@@ -43,6 +45,69 @@ struct no_arg
 
 };
 
+/**
+ * @brief   Implementation of portable_signature.
+ * @details Appends the provided arguments to the signature
+ *          one by one, and stops at the first no_arg.
+ */
+template<class Signature, class... Arg_types>
+struct portable_signature_impl
+{
+    typedef Signature type;
+};
+
+/**
+ * @brief   Specialization stopping at a non-provided argument.
+ */
+template<class Return_type, class... Done_types, class... Rest_types>
+struct portable_signature_impl<Return_type(Done_types...), no_arg, Rest_types...>
+{
+    typedef Return_type type(Done_types...);
+};
+
+/**
+ * @brief   Specialization appending a provided argument.
+ */
+template<class Return_type, class... Done_types, class Next_type, class... Rest_types>
+struct portable_signature_impl<Return_type(Done_types...), Next_type, Rest_types...>
+    : public portable_signature_impl<Return_type(Done_types..., Next_type), Rest_types...>
+{
+
+};
+
+/**
+ * @brief   Helper struct to the portable syntax wrappers.
+ * @details Converts a return type and an argument list padded
+ *          with no_arg to the signature of the wrapped type.
+ */
+template<class Return_type, class... Arg_types>
+struct portable_signature
+    : public portable_signature_impl<Return_type(), Arg_types...>
+{
+
+};
+
+/**
+ * @brief   Helper struct to the signal wrappers.
+ * @details Selects the allocator of a wrapped signal,
+ *          substituting the default allocator when
+ *          it is not provided.
+ */
+template<class Allocator_type>
+struct wrapper_allocator
+{
+    typedef Allocator_type type;
+};
+
+/**
+ * @brief   Specialization for a non-provided allocator.
+ */
+template<>
+struct wrapper_allocator<no_arg>
+{
+    typedef HYDROSIG_DEFAULT_ALLOCATOR type;
+};
+
 
 HYDROSIG_NAMESPACE_END
 
@@ -0,0 +1,183 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2017 Peter Gyulai
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Checks that emitting a fixed_signal never touches the global
+ * allocator. The global operator new and delete are replaced, and
+ * abort the program while the emitting thread has set a flag.
+ * Slots are connected with the flag cleared, then emitted with it
+ * set, for every arity up to eight, and from a second thread while
+ * the connections are changed concurrently.
+ */
+
+#include "src/hydrosig.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+
+/**< Set while the current thread must not allocate */
+thread_local bool t_forbidden = false;
+
+void* operator new(std::size_t size)
+{
+    if(t_forbidden)
+    {
+        std::fputs("Allocation during emission\n", stderr);
+        std::abort();
+    }
+
+    void* memory = std::malloc(size != 0 ? size : 1);
+    if(memory == nullptr) throw std::bad_alloc();
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    if(t_forbidden && memory != nullptr)
+    {
+        std::fputs("Deallocation during emission\n", stderr);
+        std::abort();
+    }
+
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    ::operator delete(memory);
+}
+
+
+/**< The sum of the arguments received by the slots */
+std::atomic<long> g_received(0);
+
+template<class... Arg_types>
+void receiveFree(Arg_types... args)
+{
+    long sum = 0;
+    for(int arg : {0, args...}) sum += arg;
+    g_received += sum;
+}
+
+struct receiver : public hydrosig::trackable
+{
+    template<class... Arg_types>
+    void receive(Arg_types... args)
+    {
+        receiveFree(args...);
+    }
+};
+
+/**
+ * Connects a free function, a tracked member function, a small and a
+ * large lambda to a fixed_signal taking the given ints, then emits it with
+ * allocation forbidden. Returns false if the slots were not all called.
+ */
+template<class... Arg_types>
+bool emitsWithoutAllocation(Arg_types... args)
+{
+    hydrosig::fixed_signal<8, void(Arg_types...)> signal;
+    receiver target;
+    char padding[64] = {0};
+
+    signal.connect(&receiveFree<Arg_types...>);
+    signal.connect(&target, &receiver::template receive<Arg_types...>);
+    signal.connect([](Arg_types... args) { receiveFree(args...); });
+    signal.connect([padding](Arg_types... args) { receiveFree(int(padding[0]), args...); });
+
+    long expected = 0;
+    for(int arg : {0, args...}) expected += arg;
+
+    g_received = 0;
+
+    t_forbidden = true;
+    signal.emit(args...);
+    signal(args...);
+    t_forbidden = false;
+
+    if(g_received != 8 * expected)
+    {
+        std::printf("arity %u: received %ld instead of %ld\n",
+                    unsigned(sizeof...(Arg_types)), g_received.load(), 8 * expected);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Emits a fixed_signal from a thread forbidden to allocate, while the
+ * main thread keeps connecting and disconnecting slots.
+ */
+bool emitsWithoutAllocationConcurrently()
+{
+    hydrosig::fixed_signal<8, void(int)> signal;
+    std::atomic<bool> stop(false);
+
+    std::thread emitter([&]
+    {
+        t_forbidden = true;
+        while(!stop.load(std::memory_order_relaxed)) signal.emit(1);
+        t_forbidden = false;
+    });
+
+    for(int round = 0; round < 20000; ++round)
+    {
+        receiver target;
+        hydrosig::connection<void(int)> free = signal.connect(&receiveFree<int>);
+        signal.connect(&target, &receiver::receive<int>);
+
+        free.disconnect();
+        if(round % 3 == 0) signal.clear();
+        signal.removeInvalidated();
+    }
+
+    stop = true;
+    emitter.join();
+
+    return true;
+}
+
+int main()
+{
+    bool passed = emitsWithoutAllocation() &&
+                  emitsWithoutAllocation(1) &&
+                  emitsWithoutAllocation(1, 2) &&
+                  emitsWithoutAllocation(1, 2, 3) &&
+                  emitsWithoutAllocation(1, 2, 3, 4) &&
+                  emitsWithoutAllocation(1, 2, 3, 4, 5) &&
+                  emitsWithoutAllocation(1, 2, 3, 4, 5, 6) &&
+                  emitsWithoutAllocation(1, 2, 3, 4, 5, 6, 7) &&
+                  emitsWithoutAllocation(1, 2, 3, 4, 5, 6, 7, 8) &&
+                  emitsWithoutAllocationConcurrently();
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}